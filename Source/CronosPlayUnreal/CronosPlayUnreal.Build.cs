@@ -28,7 +28,7 @@ public class CronosPlayUnreal : ModuleRules {
 
         PrivateDependencyModuleNames.AddRange(
             new string[] { "CoreUObject", "Engine", "Slate", "SlateCore",
-                           "Projects", "PlayCppSdkLibrary" });
+                           "Projects", "PlayCppSdkLibrary", "WebSockets" });
 
         DynamicallyLoadedModuleNames.AddRange(new string[] {});
 
@@ -0,0 +1,224 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "AddressCache.h"
+
+#include <stdexcept>
+
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "PlayCppSdkLibrary/Include/rust/cxx.h"
+
+using namespace org::defi_wallet_core;
+
+// first line of the decrypted file, a wrong key never yields it
+static const char *AddressFileMagic = "CronosPlayUnreal addresses 1\n";
+
+static FString deriveAddress(const Wallet &wallet, CoinType coin,
+                             int32 index) {
+    rust::cxxbridge1::String address =
+        coin == CoinType::Ethereum ? wallet.get_eth_address(index)
+                                   : wallet.get_address(coin, index);
+    return UTF8_TO_TCHAR(address.c_str());
+}
+
+// a deterministic signature of a tx that can never be valid on any chain
+// (nonce 2^64-2, zero gas price), so only the wallet can derive the key
+static FAES::FAESKey addressFileKey(const Wallet &wallet) {
+    rust::cxxbridge1::Box<PrivateKey> privatekey =
+        wallet.get_key("m/44'/60'/0'/0/0");
+    EthTxInfoRaw info = new_eth_tx_info();
+    info.to_address = "0x0000000000000000000000000000000000000000";
+    info.nonce = "18446744073709551614";
+    info.gas_limit = "21000";
+    info.gas_price = "0";
+    info.amount = "0";
+    info.amount_unit = EthAmount::EthDecimal;
+    rust::Vec<uint8_t> signedtx =
+        build_eth_signed_tx(info, (uint64)0, true, *privatekey);
+
+    uint8 digest[2][FSHA1::DigestSize];
+    for (uint8 i = 0; i < 2; i++) {
+        FSHA1 sha;
+        sha.Update(signedtx.data(), signedtx.size());
+        sha.Update(&i, 1);
+        sha.Final();
+        sha.GetHash(digest[i]);
+    }
+    FAES::FAESKey key;
+    FMemory::Memcpy(key.Key, digest, FAES::FAESKey::KeySize);
+    FMemory::Memzero(digest, sizeof(digest));
+    return key;
+}
+
+FString AddressCache::addressKey(CoinType coin, int32 index) {
+    return FString::Printf(TEXT("%d:%d"), (int32)coin, index);
+}
+
+FString AddressCache::get(const Wallet &wallet, CoinType coin, int32 index) {
+    FString key = addressKey(coin, index);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        FString *found = addresses.Find(key);
+        if (found != NULL) {
+            return *found;
+        }
+    }
+    FString address = deriveAddress(wallet, coin, index);
+    std::lock_guard<std::mutex> lock(mutex);
+    addresses.Add(key, address);
+    dirty = true;
+    return address;
+}
+
+TArray<FString> AddressCache::derive(const Wallet &wallet, CoinType coin,
+                                     int32 start, int32 count) {
+    if (start < 0 || count < 0) {
+        throw std::runtime_error("Invalid address range");
+    }
+    TArray<FString> output;
+    output.SetNum(count);
+    TArray<int32> missing;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (int32 i = 0; i < count; i++) {
+            FString *found = addresses.Find(addressKey(coin, start + i));
+            if (found != NULL) {
+                output[i] = *found;
+            } else {
+                missing.Add(i);
+            }
+        }
+    }
+    if (missing.Num() == 0) {
+        return output;
+    }
+
+    // one derivation per task, errors are rethrown on the calling thread
+    TArray<FString> errors;
+    errors.SetNum(missing.Num());
+    ParallelFor(missing.Num(), [&](int32 i) {
+        try {
+            output[missing[i]] =
+                deriveAddress(wallet, coin, start + missing[i]);
+        } catch (const std::exception &e) {
+            errors[i] = UTF8_TO_TCHAR(e.what());
+        }
+    });
+    for (const FString &error : errors) {
+        if (!error.IsEmpty()) {
+            throw std::runtime_error(TCHAR_TO_UTF8(*error));
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int32 i : missing) {
+        addresses.Add(addressKey(coin, start + i), output[i]);
+    }
+    dirty = true;
+    return output;
+}
+
+void AddressCache::attach(const Wallet &wallet, const FString &directory) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!path.IsEmpty()) {
+            return;
+        }
+    }
+
+    FAES::FAESKey key = addressFileKey(wallet);
+    // the file name doesn't tell which wallet it belongs to
+    uint8 keyhash[FSHA1::DigestSize];
+    FSHA1::HashBuffer(key.Key, FAES::FAESKey::KeySize, keyhash);
+    FString filename = FString::Printf(TEXT("addresses_%s.bin"),
+                                       *BytesToHex(keyhash, 8).ToLower());
+    FString filepath = FPaths::Combine(directory, filename);
+
+    TMap<FString, FString> loaded;
+    TArray<uint8> data;
+    if (FFileHelper::LoadFileToArray(data, *filepath, FILEREAD_Silent) &&
+        data.Num() > 0 && data.Num() % FAES::AESBlockSize == 0) {
+        FAES::DecryptData(data.GetData(), (uint64)data.Num(), key);
+        int32 magiclength = FCStringAnsi::Strlen(AddressFileMagic);
+        if (data.Num() >= magiclength &&
+            FMemory::Memcmp(data.GetData(), AddressFileMagic, magiclength) ==
+                0) {
+            // zero padding ends the text
+            int32 length = data.Find(0);
+            if (length == INDEX_NONE) {
+                length = data.Num();
+            }
+            FUTF8ToTCHAR converted(
+                (const ANSICHAR *)data.GetData() + magiclength,
+                length - magiclength);
+            FString text(converted.Length(), converted.Get());
+            TArray<FString> lines;
+            text.ParseIntoArrayLines(lines);
+            for (const FString &line : lines) {
+                FString addresskey;
+                FString address;
+                if (line.Split(TEXT("="), &addresskey, &address)) {
+                    loaded.Add(addresskey, address);
+                }
+            }
+        } else {
+            UE_LOG(LogTemp, Warning,
+                   TEXT("CronosPlayUnreal address cache %s is not readable"),
+                   *filepath);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!path.IsEmpty()) {
+        return;
+    }
+    for (const TPair<FString, FString> &address : loaded) {
+        addresses.FindOrAdd(address.Key) = address.Value;
+    }
+    // addresses derived before attaching are saved too
+    dirty = addresses.Num() > loaded.Num();
+    path = filepath;
+    filekey = key;
+}
+
+void AddressCache::save() {
+    TArray<uint8> data;
+    FString filepath;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (path.IsEmpty() || !dirty) {
+            return;
+        }
+        FString text;
+        for (const TPair<FString, FString> &address : addresses) {
+            text += address.Key + TEXT("=") + address.Value + TEXT("\n");
+        }
+        FTCHARToUTF8 utf8(*text);
+        int32 magiclength = FCStringAnsi::Strlen(AddressFileMagic);
+        data.Append((const uint8 *)AddressFileMagic, magiclength);
+        data.Append((const uint8 *)utf8.Get(), utf8.Length());
+        // zero padding up to the aes block size
+        data.AddZeroed(Align(data.Num() + 1, FAES::AESBlockSize) -
+                       data.Num());
+        FAES::EncryptData(data.GetData(), (uint64)data.Num(), filekey);
+        filepath = path;
+        dirty = false;
+    }
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(filepath), true);
+    if (!FFileHelper::SaveArrayToFile(data, *filepath)) {
+        UE_LOG(LogTemp, Warning,
+               TEXT("CronosPlayUnreal failed to save address cache %s"),
+               *filepath);
+    }
+}
+
+void AddressCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    addresses.Empty();
+    path.Empty();
+    FMemory::Memzero(filekey.Key, FAES::FAESKey::KeySize);
+    dirty = false;
+}
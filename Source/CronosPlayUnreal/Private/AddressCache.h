@@ -0,0 +1,56 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Misc/AES.h"
+#include "PlayCppSdkLibrary/Include/defi-wallet-core-cpp/src/lib.rs.h"
+#include <mutex>
+
+/**
+ * derived addresses of the hd wallet by (coin, index), so address pickers
+ * don't run bip-32 derivation for every address
+ * once attached to a file, the cache is loaded from and saved to it,
+ * encrypted with a key only the wallet can derive
+ * all methods are thread-safe
+ */
+class AddressCache {
+    std::mutex mutex;
+    // "coin:index" -> address
+    TMap<FString, FString> addresses;
+    FString path;
+    FAES::FAESKey filekey;
+    bool dirty = false;
+
+    static FString addressKey(org::defi_wallet_core::CoinType coin,
+                              int32 index);
+
+  public:
+    /**
+     * address of coin at index, derived on first use
+     * Ethereum is the same as Wallet::get_eth_address
+     */
+    FString get(const org::defi_wallet_core::Wallet &wallet,
+                org::defi_wallet_core::CoinType coin, int32 index);
+
+    /**
+     * addresses of coin at [start, start + count), the missing ones are
+     * derived in parallel on worker threads, throws if derivation fails
+     */
+    TArray<FString> derive(const org::defi_wallet_core::Wallet &wallet,
+                           org::defi_wallet_core::CoinType coin, int32 start,
+                           int32 count);
+
+    /**
+     * load the cache file of wallet under directory and save to it from now
+     * on, a missing or undecryptable file starts empty
+     * no-op if already attached
+     */
+    void attach(const org::defi_wallet_core::Wallet &wallet,
+                const FString &directory);
+
+    // write new addresses to the attached file, if any
+    void save();
+
+    // drop every address and detach, the file is kept
+    void clear();
+};
@@ -0,0 +1,29 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+
+/**
+ * run a blocking query on a worker thread and deliver its output on the game
+ * thread, like BroadcastEthTxAsync
+ * query: void(OutputType &output, bool &success, FString &output_message)
+ * Out: dynamic delegate (OutputType Output, FString Result), Result is "" if
+ * succeed
+ */
+template <typename OutputType, typename DelegateType, typename QueryType>
+void runQueryAsync(DelegateType Out, QueryType query) {
+    AsyncTask(ENamedThreads::AnyHiPriThreadNormalTask, [Out, query]() {
+        OutputType output{};
+        bool success = false;
+        FString result;
+        query(output, success, result);
+        if (!success && result.IsEmpty()) {
+            result = TEXT("Unknown Error");
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [Out, output, result]() {
+            Out.ExecuteIfBound(output, result);
+        });
+    });
+}
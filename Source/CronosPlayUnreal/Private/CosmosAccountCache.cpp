@@ -0,0 +1,96 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CosmosAccountCache.h"
+
+#include "CronosEndpointPool.h"
+#include "PlayCppSdkLibrary/Include/rust/cxx.h"
+
+using namespace std;
+using namespace org::defi_wallet_core;
+
+// cosmos-sdk ErrWrongSequence
+static const uint32_t WrongSequenceCode = 32;
+
+static auto accountKey(const std::string &address,
+                       const std::string &cosmosrest) -> std::string {
+    return cosmosrest + "|" + address;
+}
+
+std::shared_ptr<CosmosAccountCache::Entry>
+CosmosAccountCache::entry(const std::string &address,
+                          const std::string &cosmosrest) {
+    std::string key = accountKey(address, cosmosrest);
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<Entry> &found = entries[key];
+    if (!found) {
+        found = std::make_shared<Entry>();
+    }
+    return found;
+}
+
+bool CosmosAccountCache::isSequenceMismatch(uint32_t code,
+                                            const std::string &log) {
+    return code == WrongSequenceCode ||
+           log.find("account sequence mismatch") != std::string::npos;
+}
+
+void CosmosAccountCache::exclusive(const std::string &address,
+                                   const std::string &cosmosrest,
+                                   const ExclusiveFunction &run) {
+    std::shared_ptr<Entry> accountentry = entry(address, cosmosrest);
+    std::lock_guard<std::mutex> lock(accountentry->sendmutex);
+    if (!accountentry->synced.load()) {
+        // one sequence per account, whichever endpoint of the list answers
+        TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe> rest =
+            CronosEndpointPool::forEndpoints(
+                UTF8_TO_TCHAR(cosmosrest.c_str()),
+                CronosEndpointPool::EProbe::CosmosRest);
+        CronosEndpointCall call(rest, rest->pick());
+        accountentry->info = call.run([&]() {
+            return query_account_details_info(TCHAR_TO_UTF8(*call.url),
+                                              address);
+        });
+        accountentry->synced.store(true);
+    }
+
+    bool synced = false;
+    try {
+        synced = run(accountentry->info);
+    } catch (...) {
+        // the txs may or may not have reached the node
+        accountentry->synced.store(false);
+        throw;
+    }
+    if (!synced) {
+        accountentry->synced.store(false);
+    }
+}
+
+CosmosTransactionReceiptRaw
+CosmosAccountCache::send(const std::string &address,
+                         const std::string &cosmosrest,
+                         const SendFunction &sendtx) {
+    CosmosTransactionReceiptRaw receipt;
+    exclusive(address, cosmosrest, [&](CosmosAccountInfoRaw &info) {
+        receipt = sendtx(info);
+        if (receipt.code == 0) {
+            info.sequence_number++;
+            return true;
+        }
+        // sent from elsewhere meanwhile
+        return !isSequenceMismatch(receipt.code, receipt.log.c_str());
+    });
+    return receipt;
+}
+
+void CosmosAccountCache::resync(const std::string &address,
+                                const std::string &cosmosrest) {
+    entry(address, cosmosrest)->synced.store(false);
+}
+
+void CosmosAccountCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &found : entries) {
+        found.second->synced.store(false);
+    }
+}
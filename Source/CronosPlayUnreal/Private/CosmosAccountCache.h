@@ -0,0 +1,73 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "PlayCppSdkLibrary/Include/defi-wallet-core-cpp/src/lib.rs.h"
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * account number and sequence of cosmos accounts, so sends don't query the
+ * account before every transaction
+ * key: rest endpoint (or comma separated list of endpoints) and address
+ * the account is fetched on first use and after resync(), the sequence is
+ * incremented locally after every accepted broadcast
+ * all methods are thread-safe
+ */
+class CosmosAccountCache {
+    struct Entry {
+        // held by exclusive(), from signing until the broadcast result, so
+        // the sequences of one account reach the node in order
+        std::mutex sendmutex;
+        std::atomic<bool> synced{false};
+        org::defi_wallet_core::CosmosAccountInfoRaw info{0, 0};
+    };
+
+    std::mutex mutex;
+    std::map<std::string, std::shared_ptr<Entry>> entries;
+
+    std::shared_ptr<Entry> entry(const std::string &address,
+                                 const std::string &cosmosrest);
+
+  public:
+    typedef std::function<org::defi_wallet_core::CosmosTransactionReceiptRaw(
+        const org::defi_wallet_core::CosmosAccountInfoRaw &info)>
+        SendFunction;
+
+    // returns false if the sequence of info is no longer known
+    typedef std::function<bool(org::defi_wallet_core::CosmosAccountInfoRaw
+                                   &info)>
+        ExclusiveFunction;
+
+    // whether a rejected tx was signed with a stale sequence
+    static bool isSequenceMismatch(uint32_t code, const std::string &log);
+
+    /**
+     * run sendtx, which signs and broadcasts, with the account number and
+     * sequence of address
+     * a receipt with code 0 advances the sequence, an account sequence
+     * mismatch (or anything sendtx throws) fetches the account again on the
+     * next send, throws if fetching the account fails or sendtx throws
+     */
+    org::defi_wallet_core::CosmosTransactionReceiptRaw
+    send(const std::string &address, const std::string &cosmosrest,
+         const SendFunction &sendtx);
+
+    /**
+     * run with the account number and sequence of address while no other
+     * send of address runs, run advances the sequence of info past the txs
+     * it got accepted
+     * throws if fetching the account fails or run throws
+     */
+    void exclusive(const std::string &address, const std::string &cosmosrest,
+                   const ExclusiveFunction &run);
+
+    // fetch the account again on next send
+    void resync(const std::string &address, const std::string &cosmosrest);
+
+    // resync every account
+    void clear();
+};
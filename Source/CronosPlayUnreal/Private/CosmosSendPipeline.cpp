@@ -0,0 +1,197 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CosmosSendPipeline.h"
+
+#include "CosmosAccountCache.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Base64.h"
+#include "PlayCppSdkLibrary/Include/rust/cxx.h"
+
+using namespace org::defi_wallet_core;
+
+CosmosSendPipeline::CosmosSendPipeline(const FString &tendermintrpc,
+                                       const FString &cosmosrest,
+                                       const FString &address)
+    : batcher(CronosRpcBatcher::forEndpoint(tendermintrpc)),
+      rest(CronosEndpointPool::forEndpoints(
+          cosmosrest, CronosEndpointPool::EProbe::CosmosRest)),
+      account(TCHAR_TO_UTF8(*address)),
+      window(8), asyncbroadcast(false), pollinterval(1.0f), timeout(60.0f),
+      maxretries(3) {}
+
+void CosmosSendPipeline::setWindow(int32 size) { window = FMath::Max(1, size); }
+
+void CosmosSendPipeline::setAsyncBroadcast(bool enabled) {
+    asyncbroadcast = enabled;
+}
+
+void CosmosSendPipeline::setPollInterval(float seconds) {
+    pollinterval = FMath::Max(0.1f, seconds);
+}
+
+void CosmosSendPipeline::setTimeout(float seconds) {
+    timeout = FMath::Max(1.0f, seconds);
+}
+
+void CosmosSendPipeline::setMaxRetries(int32 retries) {
+    maxretries = FMath::Max(0, retries);
+}
+
+TFuture<CronosRpcBatcher::Response>
+CosmosSendPipeline::broadcast(const rust::cxxbridge1::Vec<uint8_t> &signedtx) {
+    FString params = FString::Printf(
+        TEXT("{\"tx\":\"%s\"}"),
+        *FBase64::Encode(signedtx.data(), (uint32)signedtx.size()));
+    return batcher->callFuture(asyncbroadcast ? TEXT("broadcast_tx_async")
+                                              : TEXT("broadcast_tx_sync"),
+                               params);
+}
+
+FString
+CosmosSendPipeline::waitBroadcast(TFuture<CronosRpcBatcher::Response> &future,
+                                  FString &txhash, uint32 &code, FString &log) {
+    if (!future.WaitFor(FTimespan::FromSeconds(timeout))) {
+        return TEXT("Broadcast timeout");
+    }
+    CronosRpcBatcher::Response response = future.Get();
+    if (!response.Value.IsEmpty()) {
+        return response.Value;
+    }
+    const TSharedPtr<FJsonObject> *result = NULL;
+    if (!response.Key.IsValid() || !response.Key->TryGetObject(result) ||
+        !(*result)->TryGetStringField(TEXT("hash"), txhash)) {
+        return TEXT("Invalid broadcast result");
+    }
+    code = 0;
+    (*result)->TryGetNumberField(TEXT("code"), code);
+    (*result)->TryGetStringField(TEXT("log"), log);
+    return TEXT("");
+}
+
+TSharedPtr<FJsonObject>
+CosmosSendPipeline::waitIncluded(const FString &txhash) {
+    TArray<uint8> hashbytes;
+    hashbytes.SetNumZeroed(txhash.Len() / 2);
+    HexToBytes(txhash, hashbytes.GetData());
+    FString params =
+        FString::Printf(TEXT("{\"hash\":\"%s\",\"prove\":false}"),
+                        *FBase64::Encode(hashbytes));
+
+    double deadline = FPlatformTime::Seconds() + timeout;
+    while (true) {
+        FString error;
+        TSharedPtr<FJsonValue> result =
+            batcher->callBlocking(TEXT("tx"), params, error, timeout);
+        const TSharedPtr<FJsonObject> *tx = NULL;
+        const TSharedPtr<FJsonObject> *txresult = NULL;
+        // not found is an error until the tx is in a block
+        if (error.IsEmpty() && result.IsValid() && result->TryGetObject(tx) &&
+            (*tx)->TryGetObjectField(TEXT("tx_result"), txresult)) {
+            return *txresult;
+        }
+        if (FPlatformTime::Seconds() + pollinterval > deadline) {
+            return nullptr;
+        }
+        FPlatformProcess::Sleep(pollinterval);
+    }
+}
+
+void CosmosSendPipeline::waitAll(TArray<InFlight> &inflight) {
+    for (InFlight &sent : inflight) {
+        sent.broadcast.WaitFor(FTimespan::FromSeconds(timeout));
+    }
+    inflight.Empty();
+}
+
+TArray<FString> CosmosSendPipeline::run(int32 count, CosmosAccountInfoRaw &info,
+                                        const SignFunction &sign,
+                                        bool &synced, FString &error) {
+    TArray<FString> txhashes;
+    txhashes.SetNum(count);
+    TArray<int32> retries;
+    retries.SetNumZeroed(count);
+    TArray<InFlight> inflight;
+    int32 next = 0;
+    synced = true;
+    error = TEXT("");
+    auto fail = [&error](int32 index, const FString &message) {
+        if (error.IsEmpty()) {
+            error = FString::Printf(TEXT("tx %d %s"), index, *message);
+        }
+    };
+
+    while (next < count || inflight.Num() > 0) {
+        while (next < count && inflight.Num() < window) {
+            InFlight sending;
+            sending.index = next;
+            sending.sequence = info.sequence_number;
+            sending.broadcast = broadcast(sign(next, info));
+            inflight.Add(MoveTemp(sending));
+            info.sequence_number++;
+            next++;
+        }
+
+        int32 index = inflight[0].index;
+        uint64 sequence = inflight[0].sequence;
+        FString txhash;
+        uint32 code = 0;
+        FString log;
+        FString broadcasterror =
+            waitBroadcast(inflight[0].broadcast, txhash, code, log);
+        if (!broadcasterror.IsEmpty()) {
+            // the tx may or may not have reached the node, signing it again
+            // could send it twice
+            fail(index, broadcasterror);
+            synced = false;
+            break;
+        }
+
+        if (code != 0) {
+            // rejected by CheckTx, the txs behind it fail on the gap
+            waitAll(inflight);
+            info.sequence_number = sequence;
+            next = index;
+            if (!CosmosAccountCache::isSequenceMismatch(code,
+                                                        TCHAR_TO_UTF8(*log))) {
+                fail(index, FString::Printf(TEXT("code %u %s"), code, *log));
+                next = index + 1;
+            } else if (retries[index]++ < maxretries) {
+                // sent from elsewhere meanwhile, the txs before index landed
+                CronosEndpointCall call(rest, rest->pick());
+                info = call.run([&]() {
+                    return query_account_details_info(
+                        TCHAR_TO_UTF8(*call.url), account);
+                });
+            } else {
+                fail(index, log);
+                synced = false;
+                break;
+            }
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> txresult = waitIncluded(txhash);
+        if (!txresult.IsValid()) {
+            // may still be in the mempool, can't be signed again safely
+            fail(index, TEXT("not included before timeout"));
+            synced = false;
+            break;
+        }
+        txhashes[index] = txhash;
+        // a tx failing in a block still uses its sequence
+        uint32 delivercode = 0;
+        txresult->TryGetNumberField(TEXT("code"), delivercode);
+        if (delivercode != 0) {
+            FString deliverlog;
+            txresult->TryGetStringField(TEXT("log"), deliverlog);
+            fail(index,
+                 FString::Printf(TEXT("code %u %s"), delivercode, *deliverlog));
+        }
+        inflight.RemoveAt(0);
+    }
+    if (!synced) {
+        waitAll(inflight);
+    }
+    return txhashes;
+}
@@ -0,0 +1,85 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "CronosRpcBatcher.h"
+#include "PlayCppSdkLibrary/Include/defi-wallet-core-cpp/src/lib.rs.h"
+#include <functional>
+
+/**
+ * sends many txs of one cosmos account with up to window txs in flight,
+ * signed with consecutive sequences and broadcast on the tendermint json-rpc
+ * without waiting for the previous tx to land, inclusion is confirmed
+ * separately by polling tx by hash
+ * a tx rejected by CheckTx leaves a sequence gap the txs behind it fail on,
+ * so the tail of the window is signed again from its sequence and resent
+ * run() blocks, worker threads only
+ */
+class CosmosSendPipeline {
+  public:
+    // signed tx of index with the account number and sequence of info
+    typedef std::function<rust::cxxbridge1::Vec<uint8_t>(
+        int32 index, const org::defi_wallet_core::CosmosAccountInfoRaw &info)>
+        SignFunction;
+
+    CosmosSendPipeline(const FString &tendermintrpc, const FString &cosmosrest,
+                       const FString &address);
+
+    // max txs broadcast but not included yet
+    void setWindow(int32 size);
+
+    // broadcast_tx_async instead of broadcast_tx_sync, without the CheckTx
+    // result a rejected tx is only noticed by its timeout and stops the send
+    void setAsyncBroadcast(bool enabled);
+
+    // seconds between polls of the oldest tx in flight
+    void setPollInterval(float seconds);
+
+    // seconds to wait for a broadcast result or for inclusion
+    void setTimeout(float seconds);
+
+    // resends of one tx after an account sequence mismatch
+    void setMaxRetries(int32 retries);
+
+    /**
+     * sign and send count txs from the sequence of info on
+     * info: advanced past the sent txs
+     * synced: false if the sequence of info is no longer known, e.g. a tx
+     * that didn't land in time may still be in the mempool
+     * error: first failure, "" if every tx landed with code 0
+     * returns tx hashes by index, "" for the txs that didn't land
+     */
+    TArray<FString> run(int32 count,
+                        org::defi_wallet_core::CosmosAccountInfoRaw &info,
+                        const SignFunction &sign, bool &synced,
+                        FString &error);
+
+  private:
+    struct InFlight {
+        int32 index;
+        uint64 sequence;
+        TFuture<CronosRpcBatcher::Response> broadcast;
+    };
+
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher;
+    // endpoints of the cosmos rest api, for refetching the account
+    TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe> rest;
+    std::string account;
+    int32 window;
+    bool asyncbroadcast;
+    float pollinterval;
+    float timeout;
+    int32 maxretries;
+
+    TFuture<CronosRpcBatcher::Response>
+    broadcast(const rust::cxxbridge1::Vec<uint8_t> &signedtx);
+
+    // error of the broadcast, "" if it has a result
+    FString waitBroadcast(TFuture<CronosRpcBatcher::Response> &future,
+                          FString &txhash, uint32 &code, FString &log);
+
+    // tx_result of txhash once included, nullptr on timeout
+    TSharedPtr<FJsonObject> waitIncluded(const FString &txhash);
+
+    void waitAll(TArray<InFlight> &inflight);
+};
@@ -0,0 +1,271 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosAbi.h"
+
+#include <stdexcept>
+
+#include "CronosU256.h"
+
+// keccak-f[1600] iota round constants
+static const uint64 KeccakRoundConstants[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+    0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+    0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+    0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+    0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+    0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+    0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL};
+// rho rotations and pi lane order, walking the lanes from lane 1
+static const int32 KeccakRotations[24] = {1,  3,  6,  10, 15, 21, 28, 36,
+                                          45, 55, 2,  14, 27, 41, 56, 8,
+                                          25, 43, 62, 18, 39, 61, 20, 44};
+static const int32 KeccakLanes[24] = {10, 7,  11, 17, 18, 3, 5,  16,
+                                      8,  21, 24, 4,  15, 23, 19, 13,
+                                      12, 2,  20, 14, 22, 9,  6,  1};
+
+static uint64 keccakRotate(uint64 lane, int32 bits) {
+    return (lane << bits) | (lane >> (64 - bits));
+}
+
+static void keccakPermute(uint64 state[25]) {
+    for (int32 round = 0; round < 24; round++) {
+        // theta
+        uint64 columns[5];
+        for (int32 x = 0; x < 5; x++) {
+            columns[x] = state[x] ^ state[x + 5] ^ state[x + 10] ^
+                         state[x + 15] ^ state[x + 20];
+        }
+        for (int32 x = 0; x < 5; x++) {
+            uint64 d = columns[(x + 4) % 5] ^
+                       keccakRotate(columns[(x + 1) % 5], 1);
+            for (int32 y = 0; y < 25; y += 5) {
+                state[y + x] ^= d;
+            }
+        }
+        // rho and pi
+        uint64 current = state[1];
+        for (int32 i = 0; i < 24; i++) {
+            uint64 next = state[KeccakLanes[i]];
+            state[KeccakLanes[i]] = keccakRotate(current, KeccakRotations[i]);
+            current = next;
+        }
+        // chi
+        for (int32 y = 0; y < 25; y += 5) {
+            uint64 row[5];
+            for (int32 x = 0; x < 5; x++) {
+                row[x] = state[y + x];
+            }
+            for (int32 x = 0; x < 5; x++) {
+                state[y + x] = row[x] ^ (~row[(x + 1) % 5] & row[(x + 2) % 5]);
+            }
+        }
+        // iota
+        state[0] ^= KeccakRoundConstants[round];
+    }
+}
+
+static bool isHexString(const FString &src) {
+    for (TCHAR c : src) {
+        if (!FChar::IsHexDigit(c)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+FString CronosAbi::stripHex(const FString &hexdata) {
+    FString ret = hexdata.StartsWith(TEXT("0x"), ESearchCase::IgnoreCase)
+                      ? hexdata.RightChop(2)
+                      : hexdata;
+    if (ret.Len() % 2 != 0 || !isHexString(ret)) {
+        throw std::runtime_error("Invalid hex string");
+    }
+    return ret.ToLower();
+}
+
+FString CronosAbi::normalizeAddress(const FString &address) {
+    FString ret = stripHex(address);
+    if (ret.Len() != 40) {
+        throw std::runtime_error("Invalid address");
+    }
+    return TEXT("0x") + ret;
+}
+
+FString CronosAbi::encodeAddress(const FString &address) {
+    return FString::ChrN(24, TCHAR('0')) +
+           normalizeAddress(address).RightChop(2);
+}
+
+FString CronosAbi::encodeUint256(const FString &number) {
+    FCronosU256 value;
+    if (!FCronosU256::parse(number, value)) {
+        throw std::runtime_error("Invalid or overflowing number");
+    }
+    FString ret;
+    // Limbs[3] is the most significant limb
+    for (int32 i = 3; i >= 0; i--) {
+        ret += FString::Printf(TEXT("%016llx"),
+                               (unsigned long long)value.Limbs[i]);
+    }
+    return ret;
+}
+
+FString CronosAbi::toQuantity(const FString &number) {
+    FString digits = encodeUint256(number);
+    int32 first = 0;
+    // keep the last digit of zero
+    while (first < digits.Len() - 1 && digits[first] == TCHAR('0')) {
+        first++;
+    }
+    return TEXT("0x") + digits.RightChop(first);
+}
+
+FString CronosAbi::encodeSize(int64 size) {
+    return FString::Printf(TEXT("%064llx"), (unsigned long long)size);
+}
+
+FString CronosAbi::toDecimal(const FString &hexnumber) {
+    FString digits = hexnumber.StartsWith(TEXT("0x"), ESearchCase::IgnoreCase)
+                         ? hexnumber.RightChop(2)
+                         : hexnumber;
+    if (digits.IsEmpty()) {
+        return TEXT("0");
+    }
+    FCronosU256 value;
+    if (!FCronosU256::parseHex(digits, value)) {
+        throw std::runtime_error("Invalid hex number");
+    }
+    return value.toString();
+}
+
+uint64 CronosAbi::toUint64(const FString &hexnumber) {
+    FString digits = hexnumber.StartsWith(TEXT("0x"), ESearchCase::IgnoreCase)
+                         ? hexnumber.RightChop(2)
+                         : hexnumber;
+    // leading zeros of abi words are fine
+    int32 first = 0;
+    while (first < digits.Len() && digits[first] == TCHAR('0')) {
+        first++;
+    }
+    digits = digits.RightChop(first);
+    if (digits.Len() > 16 || !isHexString(digits)) {
+        throw std::runtime_error("Invalid 64 bits hex number");
+    }
+    return digits.IsEmpty() ? 0 : FParse::HexNumber64(*digits);
+}
+
+FString CronosAbi::word(const FString &hexdata, int32 index) {
+    return wordAt(stripHex(hexdata), (int64)index * 32);
+}
+
+FString CronosAbi::wordAt(const FString &data, int64 offset) {
+    if (offset < 0 || offset % 32 != 0 || data.Len() < (offset + 32) * 2) {
+        throw std::runtime_error("Abi data too short");
+    }
+    return data.Mid((int32)(offset * 2), 64);
+}
+
+int64 CronosAbi::sizeAt(const FString &data, int64 offset) {
+    FString sizeword = wordAt(data, offset);
+    // offsets and lengths larger than 32 bits are invalid anyway
+    if (!sizeword.Left(56).Equals(FString::ChrN(56, TCHAR('0')))) {
+        throw std::runtime_error("Invalid abi offset or length");
+    }
+    return FParse::HexNumber64(*sizeword.Right(8));
+}
+
+FString CronosAbi::bytesAt(const FString &data, int64 offset) {
+    int64 length = sizeAt(data, offset);
+    int64 start = (offset + 32) * 2;
+    if (start + length * 2 > data.Len()) {
+        throw std::runtime_error("Abi data too short");
+    }
+    return data.Mid((int32)start, (int32)(length * 2));
+}
+
+FString CronosAbi::encodeBytes(const FString &hexdata) {
+    FString data = stripHex(hexdata);
+    int32 length = data.Len() / 2;
+    int32 padding = (32 - length % 32) % 32;
+    return encodeSize(length) + data +
+           FString::ChrN(padding * 2, TCHAR('0'));
+}
+
+FString CronosAbi::decodeUint256(const FString &hexdata, int32 index) {
+    return toDecimal(word(hexdata, index));
+}
+
+FString CronosAbi::decodeAddress(const FString &hexdata, int32 index) {
+    return TEXT("0x") + word(hexdata, index).RightChop(24);
+}
+
+bool CronosAbi::decodeBool(const FString &hexdata, int32 index) {
+    return word(hexdata, index) != FString::ChrN(64, TCHAR('0'));
+}
+
+FString CronosAbi::decodeBytes(const FString &hexdata, int32 index) {
+    FString data = stripHex(hexdata);
+    return bytesAt(data, sizeAt(data, (int64)index * 32));
+}
+
+FString CronosAbi::decodeString(const FString &hexdata, int32 index) {
+    TArray<uint8> bytes = hexToBytes(decodeBytes(hexdata, index));
+    bytes.Add(0);
+    return UTF8_TO_TCHAR((const char *)bytes.GetData());
+}
+
+TArray<uint8> CronosAbi::hexToBytes(const FString &hexdata) {
+    FString data = stripHex(hexdata);
+    TArray<uint8> ret;
+    ret.SetNumUninitialized(data.Len() / 2);
+    for (int32 i = 0; i < ret.Num(); i++) {
+        ret[i] = (uint8)(FParse::HexDigit(data[i * 2]) << 4 |
+                         FParse::HexDigit(data[i * 2 + 1]));
+    }
+    return ret;
+}
+
+FString CronosAbi::bytesToHex(const uint8 *data, int32 length) {
+    static const TCHAR digits[] = TEXT("0123456789abcdef");
+    FString ret;
+    ret.Reserve(length * 2);
+    for (int32 i = 0; i < length; i++) {
+        ret.AppendChar(digits[data[i] >> 4]);
+        ret.AppendChar(digits[data[i] & 0x0f]);
+    }
+    return ret;
+}
+
+TArray<uint8> CronosAbi::keccak256(const uint8 *data, int32 length) {
+    // 1088 bit rate, lanes are little endian
+    const int32 rate = 136;
+    uint64 state[25] = {0};
+    uint8 block[rate];
+    bool padded = false;
+    for (int32 offset = 0; !padded; offset += rate) {
+        int32 count = FMath::Clamp(length - offset, 0, rate);
+        FMemory::Memzero(block, rate);
+        FMemory::Memcpy(block, data + offset, count);
+        if (count < rate) {
+            block[count] ^= 0x01;
+            block[rate - 1] ^= 0x80;
+            padded = true;
+        }
+        for (int32 i = 0; i < rate / 8; i++) {
+            uint64 lane = 0;
+            for (int32 b = 7; b >= 0; b--) {
+                lane = lane << 8 | block[i * 8 + b];
+            }
+            state[i] ^= lane;
+        }
+        keccakPermute(state);
+    }
+
+    TArray<uint8> digest;
+    digest.SetNumUninitialized(32);
+    for (int32 i = 0; i < 32; i++) {
+        digest[i] = (uint8)(state[i / 8] >> (8 * (i % 8)));
+    }
+    return digest;
+}
@@ -0,0 +1,89 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * minimal solidity abi helpers for raw json-rpc eth_call
+ * hex strings are lowercase, words are 64 hex chars without 0x
+ * invalid input throws std::runtime_error
+ */
+class CronosAbi {
+  public:
+    // function selectors
+    static constexpr const TCHAR *Name = TEXT("06fdde03");
+    static constexpr const TCHAR *Symbol = TEXT("95d89b41");
+    static constexpr const TCHAR *Decimals = TEXT("313ce567");
+    static constexpr const TCHAR *TotalSupply = TEXT("18160ddd");
+    static constexpr const TCHAR *BalanceOf = TEXT("70a08231");
+    static constexpr const TCHAR *Allowance = TEXT("dd62ed3e");
+    static constexpr const TCHAR *OwnerOf = TEXT("6352211e");
+    static constexpr const TCHAR *TokenURI = TEXT("c87b56dd");
+    static constexpr const TCHAR *GetApproved = TEXT("081812fc");
+    static constexpr const TCHAR *IsApprovedForAll = TEXT("e985e9c5");
+    static constexpr const TCHAR *TokenByIndex = TEXT("4f6ccce7");
+    static constexpr const TCHAR *TokenOfOwnerByIndex = TEXT("2f745c59");
+    static constexpr const TCHAR *Erc1155BalanceOf = TEXT("00fdd58e");
+    static constexpr const TCHAR *BalanceOfBatch = TEXT("4e1273f4");
+    static constexpr const TCHAR *Uri = TEXT("0e89341c");
+    static constexpr const TCHAR *SupportsInterface = TEXT("01ffc9a7");
+    // erc-165 interface id of ERC721Enumerable
+    static constexpr const TCHAR *Erc721EnumerableId = TEXT("780e9d63");
+    // topic of Transfer(address,address,uint256), erc-20 and erc-721
+    static constexpr const TCHAR *TransferTopic = TEXT(
+        "0xddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef");
+
+    // 0x-prefixed lowercase address, throws if not 20 bytes hex
+    static FString normalizeAddress(const FString &address);
+
+    // address as abi word
+    static FString encodeAddress(const FString &address);
+
+    // decimal (or 0x hex) number as abi word
+    static FString encodeUint256(const FString &number);
+
+    // decimal (or 0x hex) number as json-rpc quantity, e.g. "0x1a"
+    static FString toQuantity(const FString &number);
+
+    // offset or length as abi word
+    static FString encodeSize(int64 size);
+
+    // strip 0x, throws if odd length or not hex
+    static FString stripHex(const FString &hexdata);
+
+    // hex quantity ("0x1a") or abi word to decimal string
+    static FString toDecimal(const FString &hexnumber);
+
+    // hex quantity ("0x1a") to number, throws if larger than 64 bits
+    static uint64 toUint64(const FString &hexnumber);
+
+    // dynamic bytes as length word and zero padded data
+    static FString encodeBytes(const FString &hexdata);
+
+    // word at index of return data
+    static FString word(const FString &hexdata, int32 index);
+
+    /**
+     * offset based access to stripped hex data, offsets are in bytes
+     * used to walk nested dynamic types without copying the data
+     */
+    static FString wordAt(const FString &data, int64 offset);
+    // word as offset or length, throws if larger than 32 bits
+    static int64 sizeAt(const FString &data, int64 offset);
+    // dynamic bytes whose length word is at offset, as hex without 0x
+    static FString bytesAt(const FString &data, int64 offset);
+
+    static FString decodeUint256(const FString &hexdata, int32 index = 0);
+    static FString decodeAddress(const FString &hexdata, int32 index = 0);
+    static bool decodeBool(const FString &hexdata, int32 index = 0);
+    // dynamic bytes whose offset is stored at word index, hex without 0x
+    static FString decodeBytes(const FString &hexdata, int32 index = 0);
+    // dynamic string whose offset is stored at word index
+    static FString decodeString(const FString &hexdata, int32 index = 0);
+
+    static TArray<uint8> hexToBytes(const FString &hexdata);
+    static FString bytesToHex(const uint8 *data, int32 length);
+
+    // ethereum keccak-256 (original keccak padding), e.g. of a signed tx
+    static TArray<uint8> keccak256(const uint8 *data, int32 length);
+};
@@ -0,0 +1,258 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosBlockClock.h"
+
+#include "Async/Async.h"
+#include "CronosAbi.h"
+#include "IWebSocket.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "WebSocketsModule.h"
+
+// seconds before reconnecting a failed websocket, polling runs meanwhile
+static const double ReconnectDelay = 30.0;
+
+static std::mutex clocksmutex;
+static TMap<FString, TSharedRef<CronosBlockClock, ESPMode::ThreadSafe>>
+    clocks;
+
+CronosBlockClock::CronosBlockClock(
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher)
+    : batcher(rpcbatcher), pollinterval(5.0f), blocknumber(0),
+      headsubscribed(false), polling(false), nextreconnect(0) {}
+
+TSharedRef<CronosBlockClock, ESPMode::ThreadSafe>
+CronosBlockClock::forEndpoint(const FString &rpcurl) {
+    std::lock_guard<std::mutex> lock(clocksmutex);
+    TSharedRef<CronosBlockClock, ESPMode::ThreadSafe> *found =
+        clocks.Find(rpcurl);
+    if (found != NULL) {
+        return *found;
+    }
+    TSharedRef<CronosBlockClock, ESPMode::ThreadSafe> clock =
+        MakeShared<CronosBlockClock, ESPMode::ThreadSafe>(
+            CronosRpcBatcher::forEndpoint(rpcurl));
+    clocks.Add(rpcurl, clock);
+    return clock;
+}
+
+void CronosBlockClock::setWebSocketUrl(const FString &wsurl) {
+    if (wsurl == websocketurl) {
+        return;
+    }
+    websocketurl = wsurl;
+    disconnect();
+    // connect to the new endpoint on the next tick
+    nextreconnect = 0;
+}
+
+void CronosBlockClock::setPollInterval(float seconds) {
+    float interval = FMath::Max(0.5f, seconds);
+    if (interval == pollinterval) {
+        return;
+    }
+    pollinterval = interval;
+    if (tickerhandle.IsValid()) {
+        // the ticker delay is fixed once added
+        removeTicker();
+        addTicker();
+    }
+}
+
+FDelegateHandle CronosBlockClock::subscribe(FOnBlock::FDelegate callback) {
+    FDelegateHandle handle = onblock.Add(callback);
+    if (!tickerhandle.IsValid()) {
+        start();
+    }
+    return handle;
+}
+
+void CronosBlockClock::unsubscribe(FDelegateHandle handle) {
+    onblock.Remove(handle);
+    if (!onblock.IsBound()) {
+        stop();
+    }
+}
+
+void CronosBlockClock::start() {
+    addTicker();
+    nextreconnect = 0;
+    tick(0);
+}
+
+void CronosBlockClock::stop() {
+    removeTicker();
+    disconnect();
+}
+
+void CronosBlockClock::addTicker() {
+    TWeakPtr<CronosBlockClock, ESPMode::ThreadSafe> weakself = AsShared();
+    FTickerDelegate tickdelegate =
+        FTickerDelegate::CreateLambda([weakself](float deltatime) {
+            TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            return self.IsValid() && self->tick(deltatime);
+        });
+#if ENGINE_MAJOR_VERSION == 4
+    tickerhandle =
+        FTicker::GetCoreTicker().AddTicker(tickdelegate, pollinterval);
+#else
+    tickerhandle =
+        FTSTicker::GetCoreTicker().AddTicker(tickdelegate, pollinterval);
+#endif
+}
+
+void CronosBlockClock::removeTicker() {
+    if (tickerhandle.IsValid()) {
+#if ENGINE_MAJOR_VERSION == 4
+        FTicker::GetCoreTicker().RemoveTicker(tickerhandle);
+#else
+        FTSTicker::GetCoreTicker().RemoveTicker(tickerhandle);
+#endif
+        tickerhandle.Reset();
+    }
+}
+
+bool CronosBlockClock::tick(float deltatime) {
+    if (!headsubscribed) {
+        pollBlockNumber();
+        if (!websocketurl.IsEmpty() && !websocket.IsValid() &&
+            FPlatformTime::Seconds() >= nextreconnect) {
+            connect();
+        }
+    }
+    return true;
+}
+
+void CronosBlockClock::connect() {
+    websocket =
+        FWebSocketsModule::Get().CreateWebSocket(websocketurl, TEXT(""));
+    TWeakPtr<CronosBlockClock, ESPMode::ThreadSafe> weakself = AsShared();
+    websocket->OnConnected().AddLambda([weakself]() {
+        TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> self =
+            weakself.Pin();
+        if (self.IsValid() && self->websocket.IsValid()) {
+            self->websocket->Send(
+                TEXT("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":"
+                     "\"eth_subscribe\",\"params\":[\"newHeads\"]}"));
+        }
+    });
+    websocket->OnMessage().AddLambda([weakself](const FString &message) {
+        TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> self =
+            weakself.Pin();
+        if (self.IsValid()) {
+            self->onMessage(message);
+        }
+    });
+    websocket->OnConnectionError().AddLambda([weakself](const FString &error) {
+        TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> self =
+            weakself.Pin();
+        if (self.IsValid()) {
+            UE_LOG(LogTemp, Warning,
+                   TEXT("CronosBlockClock newHeads subscription failed: %s"),
+                   *error);
+            self->disconnect();
+        }
+    });
+    websocket->OnClosed().AddLambda(
+        [weakself](int32 statuscode, const FString &reason, bool wasclean) {
+            TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            if (self.IsValid()) {
+                self->disconnect();
+            }
+        });
+    websocket->Connect();
+}
+
+void CronosBlockClock::disconnect() {
+    headsubscribed = false;
+    nextreconnect = FPlatformTime::Seconds() + ReconnectDelay;
+    if (!websocket.IsValid()) {
+        return;
+    }
+    TSharedPtr<IWebSocket> closing = websocket;
+    websocket.Reset();
+    closing->OnConnected().Clear();
+    closing->OnMessage().Clear();
+    closing->OnConnectionError().Clear();
+    closing->OnClosed().Clear();
+    if (closing->IsConnected()) {
+        closing->Close();
+    }
+    // may be called from a callback of the websocket, release it later
+    AsyncTask(ENamedThreads::GameThread, [closing]() {});
+}
+
+void CronosBlockClock::onMessage(const FString &message) {
+    TSharedRef<TJsonReader<TCHAR>> jsonreader =
+        TJsonReaderFactory<TCHAR>::Create(message);
+    TSharedPtr<FJsonObject> jsonobject;
+    if (!FJsonSerializer::Deserialize(jsonreader, jsonobject) ||
+        !jsonobject.IsValid()) {
+        return;
+    }
+
+    FString method;
+    if (jsonobject->TryGetStringField(TEXT("method"), method)) {
+        const TSharedPtr<FJsonObject> *params = NULL;
+        const TSharedPtr<FJsonObject> *head = NULL;
+        FString number;
+        if (method == TEXT("eth_subscription") &&
+            jsonobject->TryGetObjectField(TEXT("params"), params) &&
+            (*params)->TryGetObjectField(TEXT("result"), head) &&
+            (*head)->TryGetStringField(TEXT("number"), number)) {
+            publishQuantity(number);
+        }
+    } else {
+        // reply of eth_subscribe, the subscription id if succeed
+        FString subscription;
+        headsubscribed =
+            jsonobject->TryGetStringField(TEXT("result"), subscription);
+        if (!headsubscribed) {
+            UE_LOG(LogTemp, Warning,
+                   TEXT("CronosBlockClock newHeads is not supported, polling "
+                        "eth_blockNumber"));
+            disconnect();
+        }
+    }
+}
+
+void CronosBlockClock::pollBlockNumber() {
+    if (polling) {
+        return;
+    }
+    polling = true;
+    TWeakPtr<CronosBlockClock, ESPMode::ThreadSafe> weakself = AsShared();
+    batcher->call(
+        TEXT("eth_blockNumber"), TEXT("[]"),
+        [weakself](TSharedPtr<FJsonValue> result, FString error) {
+            TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            if (!self.IsValid()) {
+                return;
+            }
+            self->polling = false;
+            FString number;
+            if (error.IsEmpty() && result->TryGetString(number)) {
+                self->publishQuantity(number);
+            }
+        });
+}
+
+void CronosBlockClock::publishQuantity(const FString &quantity) {
+    try {
+        publish(CronosAbi::toUint64(quantity));
+    } catch (const std::exception &e) {
+        UE_LOG(LogTemp, Warning, TEXT("CronosBlockClock invalid block: %s"),
+               UTF8_TO_TCHAR(e.what()));
+    }
+}
+
+void CronosBlockClock::publish(uint64 number) {
+    if (number <= blocknumber.load()) {
+        return;
+    }
+    blocknumber.store(number);
+    onblock.Broadcast(number);
+}
@@ -0,0 +1,81 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "CronosRpcBatcher.h"
+#include <atomic>
+#include <mutex>
+
+class IWebSocket;
+
+/**
+ * shared block clock of one endpoint
+ * publishes new block numbers from an eth_subscribe newHeads subscription on
+ * the websocket endpoint, or from eth_blockNumber polling if there is no
+ * websocket endpoint or it fails, so chain polling can run once per block
+ * instead of on fixed timers
+ * the clock runs while it has subscribers
+ * game thread only, except getBlockNumber()
+ */
+class CronosBlockClock
+    : public TSharedFromThis<CronosBlockClock, ESPMode::ThreadSafe> {
+  public:
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnBlock, uint64);
+
+    explicit CronosBlockClock(
+        TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher);
+
+    /**
+     * shared clock of an endpoint, created on first use
+     */
+    static TSharedRef<CronosBlockClock, ESPMode::ThreadSafe>
+    forEndpoint(const FString &rpcurl);
+
+    // websocket endpoint for newHeads, "" polls eth_blockNumber only
+    void setWebSocketUrl(const FString &wsurl);
+
+    // seconds between eth_blockNumber polls without a subscription, a
+    // running clock switches at once
+    void setPollInterval(float seconds);
+
+    // callback is called once per new block, starts the clock
+    FDelegateHandle subscribe(FOnBlock::FDelegate callback);
+
+    // stops the clock after the last subscriber
+    void unsubscribe(FDelegateHandle handle);
+
+    // latest block number, 0 if unknown
+    uint64 getBlockNumber() const { return blocknumber.load(); }
+
+    // whether blocks come from newHeads (not from polling)
+    bool isSubscribed() const { return headsubscribed; }
+
+  private:
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher;
+    FOnBlock onblock;
+    FString websocketurl;
+    float pollinterval;
+    std::atomic<uint64> blocknumber;
+    TSharedPtr<IWebSocket> websocket;
+    bool headsubscribed;
+    bool polling;
+    double nextreconnect;
+#if ENGINE_MAJOR_VERSION == 4
+    FDelegateHandle tickerhandle;
+#else
+    FTSTicker::FDelegateHandle tickerhandle;
+#endif
+
+    void start();
+    void stop();
+    void addTicker();
+    void removeTicker();
+    bool tick(float deltatime);
+    void connect();
+    void disconnect();
+    void onMessage(const FString &message);
+    void pollBlockNumber();
+    void publishQuantity(const FString &quantity);
+    void publish(uint64 number);
+};
@@ -0,0 +1,273 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosBroadcastQueue.h"
+
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "CronosAbi.h"
+
+static std::mutex queuesmutex;
+static TMap<FString, TSharedRef<CronosBroadcastQueue, ESPMode::ThreadSafe>>
+    queues;
+
+// seconds before the first retry, doubled per attempt up to the max
+static const float RetryBaseDelay = 0.5f;
+static const float RetryMaxDelay = 30.0f;
+
+// may succeed when sent again unchanged
+static bool isTransientError(const FString &error) {
+    if (error.StartsWith(TEXT("Http error "))) {
+        int32 status = FCString::Atoi(*error.RightChop(11));
+        return status == 408 || status == 429 || status >= 500;
+    }
+    return error == TEXT("Connection failed.") ||
+           error == TEXT("Missing json-rpc response") ||
+           error == TEXT("Failed to parse json-rpc response") ||
+           error.Contains(TEXT("rate limit")) ||
+           error.Contains(TEXT("too many requests")) ||
+           error.Contains(TEXT("timeout"));
+}
+
+// the node has the tx already, e.g. an earlier attempt got through
+static bool isKnownTxError(const FString &error, int32 attempts) {
+    return error.Contains(TEXT("already known")) ||
+           error.Contains(TEXT("known transaction")) ||
+           error.Contains(TEXT("already in mempool")) ||
+           // only a retry can have used the nonce itself
+           (attempts > 1 && error.Contains(TEXT("nonce too low")));
+}
+
+static void addOneShotTicker(TFunction<void()> callback, float delay) {
+    FTickerDelegate tickerdelegate =
+        FTickerDelegate::CreateLambda([callback](float deltatime) {
+            callback();
+            return false; // one shot
+        });
+#if ENGINE_MAJOR_VERSION == 4
+    FTicker::GetCoreTicker().AddTicker(tickerdelegate, delay);
+#else
+    FTSTicker::GetCoreTicker().AddTicker(tickerdelegate, delay);
+#endif
+}
+
+CronosBroadcastQueue::CronosBroadcastQueue(
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher)
+    : batcher(rpcbatcher), inflight(0), maxinflight(4), maxqueued(1000),
+      maxretries(5), ratelimit(10.0f), burst(10.0f), tokens(10.0),
+      lastrefill(FPlatformTime::Seconds()), pumpscheduled(false) {}
+
+TSharedRef<CronosBroadcastQueue, ESPMode::ThreadSafe>
+CronosBroadcastQueue::forEndpoint(const FString &rpcurl) {
+    std::lock_guard<std::mutex> lock(queuesmutex);
+    TSharedRef<CronosBroadcastQueue, ESPMode::ThreadSafe> *found =
+        queues.Find(rpcurl);
+    if (found != NULL) {
+        return *found;
+    }
+    TSharedRef<CronosBroadcastQueue, ESPMode::ThreadSafe> queue =
+        MakeShared<CronosBroadcastQueue, ESPMode::ThreadSafe>(
+            CronosRpcBatcher::forEndpoint(rpcurl));
+    queues.Add(rpcurl, queue);
+    return queue;
+}
+
+void CronosBroadcastQueue::setMaxInFlight(int32 count) {
+    std::lock_guard<std::mutex> lock(mutex);
+    maxinflight = FMath::Max(1, count);
+}
+
+void CronosBroadcastQueue::setRateLimit(float txspersecond, int32 count) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ratelimit = FMath::Max(0.0f, txspersecond);
+    burst = (float)FMath::Max(1, count);
+    tokens = FMath::Min(tokens, (double)burst);
+}
+
+void CronosBroadcastQueue::setMaxQueued(int32 count) {
+    std::lock_guard<std::mutex> lock(mutex);
+    maxqueued = FMath::Max(1, count);
+}
+
+void CronosBroadcastQueue::setMaxRetries(int32 retries) {
+    std::lock_guard<std::mutex> lock(mutex);
+    maxretries = FMath::Max(0, retries);
+}
+
+int32 CronosBroadcastQueue::getQueueDepth() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queued.Num();
+}
+
+int32 CronosBroadcastQueue::getInFlightCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return inflight;
+}
+
+bool CronosBroadcastQueue::send(const TArray<uint8> &signedtx,
+                                Callback callback) {
+    TArray<uint8> hash = CronosAbi::keccak256(signedtx.GetData(),
+                                              signedtx.Num());
+    FString txhash =
+        TEXT("0x") + CronosAbi::bytesToHex(hash.GetData(), hash.Num());
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        QueuedTx *found = queued.Find(txhash);
+        if (found != NULL) {
+            // same tx queued already, one broadcast answers both
+            found->callbacks.Add(MoveTemp(callback));
+            return true;
+        }
+        if (queued.Num() < maxqueued) {
+            QueuedTx tx;
+            tx.params = FString::Printf(
+                TEXT("[\"0x%s\"]"),
+                *CronosAbi::bytesToHex(signedtx.GetData(), signedtx.Num()));
+            tx.callbacks.Add(MoveTemp(callback));
+            tx.attempts = 0;
+            queued.Add(txhash, MoveTemp(tx));
+            ready.Add(txhash);
+            schedulePump(0.0f);
+            return true;
+        }
+    }
+
+    // backpressure, the caller may slow down and send again
+    AsyncTask(ENamedThreads::GameThread, [callback]() {
+        callback(TEXT(""), TEXT("Broadcast queue full"));
+    });
+    return false;
+}
+
+void CronosBroadcastQueue::schedulePump(float delay) {
+    // caller holds mutex
+    if (pumpscheduled) {
+        return;
+    }
+    pumpscheduled = true;
+
+    TWeakPtr<CronosBroadcastQueue, ESPMode::ThreadSafe> weakself = AsShared();
+    AsyncTask(ENamedThreads::GameThread, [weakself, delay]() {
+        addOneShotTicker(
+            [weakself]() {
+                TSharedPtr<CronosBroadcastQueue, ESPMode::ThreadSafe> self =
+                    weakself.Pin();
+                if (self.IsValid()) {
+                    self->pump();
+                }
+            },
+            delay);
+    });
+}
+
+void CronosBroadcastQueue::retryLater(const FString &txhash, float delay) {
+    // game thread only
+    TWeakPtr<CronosBroadcastQueue, ESPMode::ThreadSafe> weakself = AsShared();
+    addOneShotTicker(
+        [weakself, txhash]() {
+            TSharedPtr<CronosBroadcastQueue, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            if (!self.IsValid()) {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(self->mutex);
+                // ahead of the txs queued after it, e.g. higher nonces
+                self->ready.Insert(txhash, 0);
+            }
+            self->pump();
+        },
+        delay);
+}
+
+void CronosBroadcastQueue::pump() {
+    TArray<TPair<FString, FString>> sending;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pumpscheduled = false;
+
+        double now = FPlatformTime::Seconds();
+        if (ratelimit > 0.0f) {
+            tokens = FMath::Min((double)burst,
+                                tokens + (now - lastrefill) * ratelimit);
+        }
+        lastrefill = now;
+
+        while (ready.Num() > 0 && inflight < maxinflight) {
+            if (ratelimit > 0.0f && tokens < 1.0) {
+                // wait for the next token
+                schedulePump((float)((1.0 - tokens) / ratelimit));
+                break;
+            }
+            FString txhash = ready[0];
+            ready.RemoveAt(0);
+            QueuedTx *tx = queued.Find(txhash);
+            if (tx == NULL) {
+                continue;
+            }
+            tx->attempts++;
+            inflight++;
+            tokens -= 1.0;
+            sending.Add(TPair<FString, FString>(txhash, tx->params));
+        }
+    }
+
+    TWeakPtr<CronosBroadcastQueue, ESPMode::ThreadSafe> weakself = AsShared();
+    for (const TPair<FString, FString> &tx : sending) {
+        FString txhash = tx.Key;
+        batcher->call(TEXT("eth_sendRawTransaction"), tx.Value,
+                      [weakself, txhash](TSharedPtr<FJsonValue> result,
+                                         FString error) {
+                          TSharedPtr<CronosBroadcastQueue,
+                                     ESPMode::ThreadSafe>
+                              self = weakself.Pin();
+                          if (self.IsValid()) {
+                              self->complete(txhash, result, error);
+                          }
+                      });
+    }
+}
+
+void CronosBroadcastQueue::complete(const FString &txhash,
+                                    TSharedPtr<FJsonValue> result,
+                                    FString error) {
+    TArray<Callback> callbacks;
+    FString senthash = txhash;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        inflight--;
+        QueuedTx *tx = queued.Find(txhash);
+        if (tx == NULL) {
+            return;
+        }
+        if (error.IsEmpty()) {
+            FString nodehash;
+            if (result.IsValid() && result->TryGetString(nodehash) &&
+                !nodehash.IsEmpty()) {
+                senthash = nodehash;
+            }
+        } else if (isKnownTxError(error, tx->attempts)) {
+            error = TEXT("");
+        } else if (isTransientError(error) && tx->attempts <= maxretries) {
+            float delay = FMath::Min(
+                RetryMaxDelay,
+                RetryBaseDelay * (float)(1 << FMath::Min(tx->attempts - 1,
+                                                         16)));
+            // jitter, so retries of a burst don't hit the node together
+            delay *= FMath::FRandRange(0.5f, 1.5f);
+            UE_LOG(LogTemp, Log,
+                   TEXT("CronosPlayUnreal broadcast %s retry in %.1fs: %s"),
+                   *txhash, delay, *error);
+            retryLater(txhash, delay);
+            schedulePump(0.0f);
+            return;
+        }
+        callbacks = MoveTemp(tx->callbacks);
+        queued.Remove(txhash);
+        // a slot is free
+        schedulePump(0.0f);
+    }
+
+    for (Callback &callback : callbacks) {
+        callback(error.IsEmpty() ? senthash : FString(), error);
+    }
+}
@@ -0,0 +1,87 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "CronosRpcBatcher.h"
+#include <mutex>
+
+/**
+ * broadcast queue of one cronos evm endpoint, eth_sendRawTransaction calls
+ * are sent with at most maxinflight in flight and a token bucket rate limit,
+ * transient errors (connection, http 429 / 5xx, rate limited) are retried
+ * with jittered exponential backoff
+ * txs are keyed by their hash, so the same tx is never in flight twice and
+ * "already known" on a retry counts as sent
+ * send() is thread-safe, callbacks run on the game thread
+ */
+class CronosBroadcastQueue
+    : public TSharedFromThis<CronosBroadcastQueue, ESPMode::ThreadSafe> {
+  public:
+    // txhash: 0x hex, error: "" if succeed
+    typedef TFunction<void(FString txhash, FString error)> Callback;
+
+    explicit CronosBroadcastQueue(
+        TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher);
+
+    /**
+     * shared queue of an endpoint, created on first use
+     */
+    static TSharedRef<CronosBroadcastQueue, ESPMode::ThreadSafe>
+    forEndpoint(const FString &rpcurl);
+
+    // max eth_sendRawTransaction calls waiting for their response
+    void setMaxInFlight(int32 count);
+
+    // txs per second, 0 disables the limit, burst: txs sent at once after
+    // being idle
+    void setRateLimit(float txspersecond, int32 burst);
+
+    // max queued txs (waiting, in flight or backing off) before send()
+    // refuses new ones
+    void setMaxQueued(int32 count);
+
+    // retries of a tx after transient errors
+    void setMaxRetries(int32 retries);
+
+    /**
+     * queue signedtx for broadcast, callback is called once with its hash or
+     * the error after the last retry
+     * returns false if the queue is full, the tx is not sent then and
+     * callback gets the error
+     */
+    bool send(const TArray<uint8> &signedtx, Callback callback);
+
+    // queued txs, waiting, in flight or backing off
+    int32 getQueueDepth();
+
+    int32 getInFlightCount();
+
+  private:
+    struct QueuedTx {
+        FString params;
+        TArray<Callback> callbacks;
+        int32 attempts;
+    };
+
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher;
+    std::mutex mutex;
+    // hashes of txs ready to send, in order
+    TArray<FString> ready;
+    // every queued tx by hash
+    TMap<FString, QueuedTx> queued;
+    int32 inflight;
+    int32 maxinflight;
+    int32 maxqueued;
+    int32 maxretries;
+    float ratelimit;
+    float burst;
+    double tokens;
+    double lastrefill;
+    bool pumpscheduled;
+
+    void schedulePump(float delay);
+    void retryLater(const FString &txhash, float delay);
+    void pump();
+    void complete(const FString &txhash, TSharedPtr<FJsonValue> result,
+                  FString error);
+};
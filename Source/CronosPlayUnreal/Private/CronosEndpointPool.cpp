@@ -0,0 +1,381 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosEndpointPool.h"
+
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "PlayCppSdkDownloader.h"
+#include <algorithm>
+#include <cctype>
+
+static std::mutex poolsmutex;
+static TMap<FString, TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe>>
+    pools;
+
+// weight of the newest sample in the ewmas
+static const double EndpointEwmaWeight = 0.2;
+// another endpoint must be this much faster to replace the current one
+static const double EndpointSwitchRatio = 0.8;
+// assumed latency of an endpoint that was never measured
+static const double EndpointUnknownLatency = 1.0;
+static const float ProbeTimeout = 5.0f;
+// latencies kept per endpoint for percentiles, and the fewest to use one
+static const int32 LatencySamples = 100;
+static const int32 LatencyMinSamples = 20;
+// probe answers in a row that end an ejection early
+static const int32 ProbeSuccesses = 3;
+
+CronosEndpointPool::CronosEndpointPool(const TArray<FString> &urls,
+                                       EProbe probetype)
+    : probe(probetype), ejectfailures(3), ejectseconds(30.0f),
+      probeinterval(5.0f), lastprobe(0.0), probing(false) {
+    for (const FString &url : urls) {
+        Endpoint endpoint;
+        endpoint.url = url;
+        endpoint.latency = -1.0;
+        endpoint.errorrate = 0.0;
+        endpoint.failures = 0;
+        endpoint.ejecteduntil = 0.0;
+        endpoint.probesuccesses = 0;
+        endpoint.nextsample = 0;
+        endpoints.Add(endpoint);
+    }
+    if (endpoints.Num() == 0) {
+        // pick() always has an answer, the call fails on it instead
+        Endpoint endpoint{FString(), -1.0, 0.0, 0, 0.0, 0, TArray<double>(),
+                          0};
+        endpoints.Add(endpoint);
+    }
+    current = endpoints[0].url;
+}
+
+TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe>
+CronosEndpointPool::forEndpoints(const FString &endpoints, EProbe probetype) {
+    FString key = FString::Printf(TEXT("%d|%s"), (int32)probetype, *endpoints);
+    std::lock_guard<std::mutex> lock(poolsmutex);
+    TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe> *found =
+        pools.Find(key);
+    if (found != NULL) {
+        return *found;
+    }
+    TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe> pool =
+        MakeShared<CronosEndpointPool, ESPMode::ThreadSafe>(split(endpoints),
+                                                           probetype);
+    pools.Add(key, pool);
+    return pool;
+}
+
+bool CronosEndpointPool::isReached(FHttpResponsePtr response,
+                                   bool connectedSuccessfully) {
+    if (!connectedSuccessfully || !response.IsValid()) {
+        return false;
+    }
+    int32 status = response->GetResponseCode();
+    return status != 429 && status < 500;
+}
+
+bool CronosEndpointPool::isTransportError(const std::string &message) {
+    std::string lower = message;
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    // as worded by reqwest, hyper and tonic
+    static const char *const markers[] = {
+        "error sending request", "connect",         "timed out",
+        "timeout",               "dns error",       "transport error",
+        "unavailable",           "bad gateway",     "gateway timeout",
+        "too many requests",     "broken pipe",     "connection reset",
+    };
+    for (const char *marker : markers) {
+        if (lower.find(marker) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+TArray<FString> CronosEndpointPool::split(const FString &endpoints) {
+    TArray<FString> parts;
+    endpoints.ParseIntoArray(parts, TEXT(","), true);
+    TArray<FString> urls;
+    for (const FString &part : parts) {
+        FString url = part.TrimStartAndEnd();
+        if (!url.IsEmpty()) {
+            urls.Add(url);
+        }
+    }
+    return urls;
+}
+
+int32 CronosEndpointPool::getCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return endpoints.Num();
+}
+
+double CronosEndpointPool::score(const Endpoint &endpoint) {
+    double latency =
+        endpoint.latency < 0.0 ? EndpointUnknownLatency : endpoint.latency;
+    // an endpoint failing half the time is as good as one 3x slower
+    return latency * (1.0 + 4.0 * endpoint.errorrate);
+}
+
+FString CronosEndpointPool::pick(const FString &exclude) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (endpoints.Num() == 1) {
+        return endpoints[0].url;
+    }
+
+    double now = FPlatformTime::Seconds();
+    const Endpoint *best = NULL;
+    const Endpoint *currentendpoint = NULL;
+    const Endpoint *firstback = NULL;
+    for (const Endpoint &endpoint : endpoints) {
+        if (endpoint.url == exclude) {
+            continue;
+        }
+        if (endpoint.ejecteduntil > now) {
+            if (firstback == NULL ||
+                endpoint.ejecteduntil < firstback->ejecteduntil) {
+                firstback = &endpoint;
+            }
+            continue;
+        }
+        if (best == NULL || score(endpoint) < score(*best)) {
+            best = &endpoint;
+        }
+        if (endpoint.url == current) {
+            currentendpoint = &endpoint;
+        }
+    }
+    if (best == NULL) {
+        return firstback != NULL ? firstback->url : exclude;
+    }
+    // stay put unless clearly faster, so connections and handles are reused
+    if (currentendpoint != NULL &&
+        score(*best) >= score(*currentendpoint) * EndpointSwitchRatio) {
+        return current;
+    }
+    if (current == exclude) {
+        // a hedge or retry, not a reason to leave the current endpoint
+        return best->url;
+    }
+    if (best->url != current) {
+        UE_LOG(LogTemp, Log, TEXT("CronosPlayUnreal switching endpoint to %s"),
+               *best->url);
+        current = best->url;
+    }
+    return current;
+}
+
+void CronosEndpointPool::report(const FString &url, double seconds,
+                                bool reached) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (Endpoint &endpoint : endpoints) {
+        if (endpoint.url != url) {
+            continue;
+        }
+        endpoint.errorrate += EndpointEwmaWeight *
+                              ((reached ? 0.0 : 1.0) - endpoint.errorrate);
+        if (reached) {
+            endpoint.failures = 0;
+            endpoint.ejecteduntil = 0.0;
+            if (seconds < 0.0) {
+                return;
+            }
+            endpoint.latency =
+                endpoint.latency < 0.0
+                    ? seconds
+                    : endpoint.latency +
+                          EndpointEwmaWeight * (seconds - endpoint.latency);
+            if (endpoint.samples.Num() < LatencySamples) {
+                endpoint.samples.Add(seconds);
+            } else {
+                endpoint.samples[endpoint.nextsample] = seconds;
+                endpoint.nextsample =
+                    (endpoint.nextsample + 1) % LatencySamples;
+            }
+        } else if (++endpoint.failures >= ejectfailures &&
+                   endpoints.Num() > 1) {
+            endpoint.ejecteduntil = FPlatformTime::Seconds() + ejectseconds;
+            endpoint.probesuccesses = 0;
+            UE_LOG(LogTemp, Warning,
+                   TEXT("CronosPlayUnreal endpoint %s ejected for %.0fs"),
+                   *url, ejectseconds);
+            if (!probing) {
+                probing = true;
+                startProbing();
+            }
+        }
+        return;
+    }
+}
+
+void CronosEndpointPool::reportProbe(const FString &url, bool reached) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (Endpoint &endpoint : endpoints) {
+        if (endpoint.url != url || endpoint.ejecteduntil <= 0.0) {
+            continue;
+        }
+        if (!reached) {
+            endpoint.probesuccesses = 0;
+        } else if (++endpoint.probesuccesses >= ProbeSuccesses) {
+            UE_LOG(LogTemp, Log,
+                   TEXT("CronosPlayUnreal endpoint %s back after %d probes"),
+                   *url, endpoint.probesuccesses);
+            endpoint.failures = 0;
+            endpoint.ejecteduntil = 0.0;
+            endpoint.probesuccesses = 0;
+        }
+        return;
+    }
+}
+
+double CronosEndpointPool::getLatencyPercentile(const FString &url,
+                                                double percentile) {
+    TArray<double> sorted;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const Endpoint &endpoint : endpoints) {
+            if (endpoint.url == url) {
+                sorted = endpoint.samples;
+                break;
+            }
+        }
+    }
+    if (sorted.Num() < LatencyMinSamples) {
+        return -1.0;
+    }
+    sorted.Sort();
+    int32 index = FMath::Clamp(
+        FMath::CeilToInt(percentile * sorted.Num()) - 1, 0, sorted.Num() - 1);
+    return sorted[index];
+}
+
+void CronosEndpointPool::setEjection(int32 failures, float seconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ejectfailures = FMath::Max(1, failures);
+    ejectseconds = FMath::Max(0.0f, seconds);
+}
+
+void CronosEndpointPool::setProbeInterval(float seconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    probeinterval = FMath::Max(1.0f, seconds);
+}
+
+void CronosEndpointPool::startProbing() {
+    TWeakPtr<CronosEndpointPool, ESPMode::ThreadSafe> weakself = AsShared();
+    AsyncTask(ENamedThreads::GameThread, [weakself]() {
+        // every second, probing itself follows probeinterval
+        FTickerDelegate probedelegate =
+            FTickerDelegate::CreateLambda([weakself](float deltatime) {
+                TSharedPtr<CronosEndpointPool, ESPMode::ThreadSafe> self =
+                    weakself.Pin();
+                return self.IsValid() && self->onProbeTick();
+            });
+#if ENGINE_MAJOR_VERSION == 4
+        FTicker::GetCoreTicker().AddTicker(probedelegate, 1.0f);
+#else
+        FTSTicker::GetCoreTicker().AddTicker(probedelegate, 1.0f);
+#endif
+    });
+}
+
+bool CronosEndpointPool::onProbeTick() {
+    TArray<FString> urls;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        double now = FPlatformTime::Seconds();
+        bool ejected = false;
+        for (Endpoint &endpoint : endpoints) {
+            if (endpoint.ejecteduntil <= 0.0) {
+                continue;
+            }
+            if (endpoint.ejecteduntil <= now) {
+                // back on its own, failures are kept so that one more
+                // failure ejects it again
+                endpoint.ejecteduntil = 0.0;
+                endpoint.probesuccesses = 0;
+                continue;
+            }
+            ejected = true;
+            urls.Add(endpoint.url);
+        }
+        if (!ejected) {
+            // started again by the next ejection
+            probing = false;
+            return false;
+        }
+        if (now - lastprobe < probeinterval) {
+            return true;
+        }
+        lastprobe = now;
+    }
+    for (const FString &url : urls) {
+        probeEndpoint(url);
+    }
+    return true;
+}
+
+void CronosEndpointPool::probeEndpoint(const FString &url) {
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> httprequest =
+        FHttpModule::Get().CreateRequest();
+    httprequest->SetHeader(TEXT("User-Agent"),
+                           UPlayCppSdkDownloader::UserAgent);
+    httprequest->SetTimeout(ProbeTimeout);
+    switch (probe) {
+    case EProbe::JsonRpc:
+        httprequest->SetVerb(TEXT("POST"));
+        httprequest->SetURL(url);
+        httprequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+        httprequest->SetContentAsString(
+            TEXT("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"eth_chainId\","
+                 "\"params\":[]}"));
+        break;
+    case EProbe::Tendermint:
+        httprequest->SetVerb(TEXT("GET"));
+        httprequest->SetURL(url / TEXT("health"));
+        break;
+    case EProbe::CosmosRest:
+        httprequest->SetVerb(TEXT("GET"));
+        httprequest->SetURL(url /
+                            TEXT("cosmos/base/tendermint/v1beta1/syncing"));
+        break;
+    case EProbe::Connect:
+        httprequest->SetVerb(TEXT("GET"));
+        httprequest->SetURL(url);
+        break;
+    }
+
+    TWeakPtr<CronosEndpointPool, ESPMode::ThreadSafe> weakself = AsShared();
+    EProbe probetype = probe;
+    httprequest->OnProcessRequestComplete().BindLambda(
+        [weakself, url, probetype](FHttpRequestPtr request,
+                                   FHttpResponsePtr response,
+                                   bool connectedSuccessfully) {
+            TSharedPtr<CronosEndpointPool, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            if (!self.IsValid()) {
+                return;
+            }
+            bool reached =
+                probetype == EProbe::Connect
+                    ? connectedSuccessfully && response.IsValid()
+                    : isReached(response, connectedSuccessfully);
+            self->reportProbe(url, reached);
+        });
+    httprequest->ProcessRequest();
+}
+
+CronosEndpointCall::CronosEndpointCall(
+    TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe> pool,
+    const FString &url, bool timed)
+    : url(url), pool(pool), timed(timed) {}
+
+CronosEndpointCall::Outcome::Outcome(const CronosEndpointCall &call)
+    : call(call), start(FPlatformTime::Seconds()), reached(true) {}
+
+CronosEndpointCall::Outcome::~Outcome() {
+    double seconds = call.timed ? FPlatformTime::Seconds() - start : -1.0;
+    call.pool->report(call.url, seconds, reached);
+}
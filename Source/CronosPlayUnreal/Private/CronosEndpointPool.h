@@ -0,0 +1,157 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpResponse.h"
+#include <exception>
+#include <mutex>
+#include <string>
+
+/**
+ * health of the endpoints of one comma separated endpoint list, e.g.
+ * "https://a,https://b": an ewma of latency and error rate per endpoint,
+ * and a temporary ejection after consecutive failures
+ * ejected endpoints are probed in the background, they come back when the
+ * ejection ends or after ProbeSuccesses answers in a row
+ * all methods are thread-safe
+ */
+class CronosEndpointPool
+    : public TSharedFromThis<CronosEndpointPool, ESPMode::ThreadSafe> {
+  public:
+    // how an endpoint is probed
+    enum class EProbe {
+        JsonRpc,    // POST eth_chainId
+        Tendermint, // GET /health
+        CosmosRest, // GET /cosmos/base/tendermint/v1beta1/syncing
+        Connect,    // any http answer, e.g. grpc
+    };
+
+    CronosEndpointPool(const TArray<FString> &urls, EProbe probetype);
+
+    /**
+     * shared pool of an endpoint list, created on first use
+     */
+    static TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe>
+    forEndpoints(const FString &endpoints, EProbe probetype);
+
+    // whether an http answer means the endpoint is up: connected, not http
+    // 429 and not 5xx
+    static bool isReached(FHttpResponsePtr response,
+                          bool connectedSuccessfully);
+
+    // whether an sdk error means the endpoint didn't answer: connection,
+    // timeout, http 429 or 5xx
+    static bool isTransportError(const std::string &message);
+
+    // trimmed endpoints of a comma separated list, in order
+    static TArray<FString> split(const FString &endpoints);
+
+    /**
+     * fastest healthy endpoint, the current one is kept unless another is
+     * clearly faster, the one ejected first if all are ejected
+     * @param exclude endpoint to avoid if there is another, e.g. one that
+     * just failed or a hedged one, it stays the current one
+     */
+    FString pick(const FString &exclude = FString());
+
+    int32 getCount();
+
+    /**
+     * outcome of a call to url
+     * @param reached false if the endpoint didn't answer (connection
+     * failed, http 429 or 5xx), json-rpc errors are answers
+     * @param seconds < 0 if the call took longer than the endpoint, e.g. a
+     * send waiting for its receipt
+     */
+    void report(const FString &url, double seconds, bool reached);
+
+    /**
+     * latency percentile of url over its recent answered calls, e.g. 0.95
+     * for p95, < 0 until there are enough samples
+     */
+    double getLatencyPercentile(const FString &url, double percentile);
+
+    // consecutive failures before an endpoint is ejected, and for how long
+    void setEjection(int32 failures, float seconds);
+
+    // seconds between background probes
+    void setProbeInterval(float seconds);
+
+  private:
+    struct Endpoint {
+        FString url;
+        // ewma in seconds, < 0 until measured
+        double latency;
+        // ewma of failures, 0..1
+        double errorrate;
+        int32 failures;
+        // 0 unless ejected, the probe tick clears it once passed
+        double ejecteduntil;
+        // probe answers in a row while ejected
+        int32 probesuccesses;
+        // latest latencies, a ring of up to LatencySamples
+        TArray<double> samples;
+        int32 nextsample;
+    };
+
+    std::mutex mutex;
+    TArray<Endpoint> endpoints;
+    EProbe probe;
+    FString current;
+    int32 ejectfailures;
+    float ejectseconds;
+    float probeinterval;
+    double lastprobe;
+    bool probing;
+
+    static double score(const Endpoint &endpoint);
+    void startProbing();
+    bool onProbeTick();
+    void probeEndpoint(const FString &url);
+    // probes only end ejections, calls alone make latency and error rate
+    void reportProbe(const FString &url, bool reached);
+};
+
+/**
+ * a blocking sdk call to one endpoint of a pool, reported to the pool
+ * CronosEndpointCall rpc(pool, pool->pick());
+ * U256 balance = rpc.run([&]() { return erc20.balance_of(account); });
+ */
+class CronosEndpointCall {
+  public:
+    /**
+     * @param timed false if the calls take longer than the endpoint, e.g.
+     * sends waiting for their receipt, only their outcome is reported
+     */
+    CronosEndpointCall(TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe> pool,
+                       const FString &url, bool timed = true);
+
+    const FString url;
+
+    /**
+     * runs function, a call to url, exceptions are rethrown once reported
+     */
+    template <typename Function>
+    auto run(Function function) const -> decltype(function()) {
+        Outcome outcome(*this);
+        try {
+            return function();
+        } catch (const std::exception &e) {
+            outcome.reached = !CronosEndpointPool::isTransportError(e.what());
+            throw;
+        }
+    }
+
+  private:
+    // reports on return, so void calls are reported too
+    struct Outcome {
+        Outcome(const CronosEndpointCall &call);
+        ~Outcome();
+        const CronosEndpointCall &call;
+        double start;
+        bool reached;
+    };
+
+    TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe> pool;
+    bool timed;
+};
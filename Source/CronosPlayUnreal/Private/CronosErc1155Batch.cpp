@@ -0,0 +1,144 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosErc1155Batch.h"
+
+#include "Async/Async.h"
+#include <stdexcept>
+
+#include "CronosAbi.h"
+
+CronosErc1155Batch::CronosErc1155Batch(
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher,
+    const FString &contract, const TArray<FString> &accounts,
+    const TArray<FString> &tokenids, int32 chunksize)
+    : batcher(rpcbatcher),
+      contractaddress(CronosAbi::normalizeAddress(contract)),
+      maxchunk(FMath::Max(1, chunksize)), pending(accounts.Num()),
+      finished(false) {
+    if (accounts.Num() != tokenids.Num()) {
+        throw std::runtime_error(
+            "accountAddresses and tokenIDs differ in length");
+    }
+    accountwords.Reserve(accounts.Num());
+    tokenwords.Reserve(tokenids.Num());
+    for (int32 i = 0; i < accounts.Num(); i++) {
+        accountwords.Add(CronosAbi::encodeAddress(accounts[i]));
+        tokenwords.Add(CronosAbi::encodeUint256(tokenids[i]));
+    }
+    balances.SetNum(accounts.Num());
+}
+
+void CronosErc1155Batch::start(Callback ondone) {
+    callback = ondone;
+    if (pending == 0) {
+        // still on a later frame, like every other answer
+        TSharedRef<CronosErc1155Batch, ESPMode::ThreadSafe> self =
+            AsShared();
+        AsyncTask(ENamedThreads::GameThread,
+                  [self]() { self->finish(FString()); });
+        return;
+    }
+    for (int32 start = 0; start < accountwords.Num(); start += maxchunk) {
+        fetch(start, FMath::Min(maxchunk, accountwords.Num() - start), 1);
+    }
+}
+
+FString CronosErc1155Batch::encode(int32 start, int32 count) const {
+    // balanceOfBatch(address[],uint256[]): offsets of both arrays, then
+    // each array as length and words
+    FString data = CronosAbi::BalanceOfBatch + CronosAbi::encodeSize(64) +
+                   CronosAbi::encodeSize(96 + (int64)count * 32) +
+                   CronosAbi::encodeSize(count);
+    for (int32 i = start; i < start + count; i++) {
+        data += accountwords[i];
+    }
+    data += CronosAbi::encodeSize(count);
+    for (int32 i = start; i < start + count; i++) {
+        data += tokenwords[i];
+    }
+    return data;
+}
+
+TArray<FString> CronosErc1155Batch::decode(const FString &returndata,
+                                           int32 count) {
+    FString data = CronosAbi::stripHex(returndata);
+    int64 array = CronosAbi::sizeAt(data, 0);
+    if (CronosAbi::sizeAt(data, array) != count) {
+        throw std::runtime_error("balanceOfBatch result count mismatch");
+    }
+    TArray<FString> ret;
+    ret.Reserve(count);
+    for (int32 i = 0; i < count; i++) {
+        ret.Add(CronosAbi::toDecimal(
+            CronosAbi::wordAt(data, array + 32 + (int64)i * 32)));
+    }
+    return ret;
+}
+
+void CronosErc1155Batch::fetch(int32 start, int32 count, int32 attempt) {
+    FString params = FString::Printf(
+        TEXT("[{\"to\":\"%s\",\"data\":\"0x%s\"},\"latest\"]"),
+        *contractaddress, *encode(start, count));
+    TSharedRef<CronosErc1155Batch, ESPMode::ThreadSafe> self = AsShared();
+    batcher->call(TEXT("eth_call"), params,
+                  [self, start, count, attempt](TSharedPtr<FJsonValue> result,
+                                                FString error) {
+                      self->onChunk(start, count, attempt, result, error);
+                  });
+}
+
+void CronosErc1155Batch::onChunk(int32 start, int32 count, int32 attempt,
+                                 TSharedPtr<FJsonValue> result,
+                                 const FString &error) {
+    if (finished) {
+        return;
+    }
+    FString chunkerror = error;
+    FString data;
+    if (chunkerror.IsEmpty() && !result->TryGetString(data)) {
+        chunkerror = TEXT("Invalid json-rpc result");
+    }
+    if (chunkerror.IsEmpty()) {
+        try {
+            TArray<FString> chunkbalances = decode(data, count);
+            for (int32 i = 0; i < count; i++) {
+                balances[start + i] = chunkbalances[i];
+            }
+        } catch (const std::exception &e) {
+            chunkerror = UTF8_TO_TCHAR(e.what());
+        }
+    }
+
+    if (!chunkerror.IsEmpty()) {
+        if (attempt >= MaxAttempts) {
+            finish(chunkerror);
+        } else if (count > 1) {
+            // smaller calls get under a calldata or gas cap
+            int32 half = count / 2;
+            fetch(start, half, attempt + 1);
+            fetch(start + half, count - half, attempt + 1);
+        } else {
+            fetch(start, count, attempt + 1);
+        }
+        return;
+    }
+
+    pending -= count;
+    if (pending == 0) {
+        finish(FString());
+    }
+}
+
+void CronosErc1155Batch::finish(const FString &error) {
+    if (finished) {
+        return;
+    }
+    finished = true;
+    if (!error.IsEmpty()) {
+        balances.Empty();
+    }
+    if (callback) {
+        callback(balances, error);
+    }
+    callback = nullptr;
+}
@@ -0,0 +1,66 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "CronosRpcBatcher.h"
+
+/**
+ * erc-1155 balanceOfBatch of any number of (account, token id) pairs, split
+ * into chunks of a bounded size so no eth_call hits the calldata or gas cap
+ * of the node, the chunks are sent at once through the batcher
+ * a failed chunk is retried, in halves if it has more than one pair
+ * balances are merged in the order of the input
+ * game thread only, the callback runs on the game thread, kept alive by its
+ * calls in flight
+ */
+class CronosErc1155Batch
+    : public TSharedFromThis<CronosErc1155Batch, ESPMode::ThreadSafe> {
+  public:
+    // tries of a pair before the batch fails
+    static constexpr int32 MaxAttempts = 3;
+
+    /**
+     * balances: one decimal balance per pair, empty if failed
+     * error: "" if succeed
+     */
+    typedef TFunction<void(const TArray<FString> &balances,
+                           const FString &error)>
+        Callback;
+
+    /**
+     * throws if an address or token id is invalid or accounts and tokenids
+     * differ in length
+     * @param chunksize max pairs per eth_call
+     */
+    CronosErc1155Batch(
+        TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher,
+        const FString &contract, const TArray<FString> &accounts,
+        const TArray<FString> &tokenids, int32 chunksize);
+
+    // send every chunk
+    void start(Callback ondone);
+
+  private:
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher;
+    FString contractaddress;
+    // abi words of the pairs
+    TArray<FString> accountwords;
+    TArray<FString> tokenwords;
+    int32 maxchunk;
+    TArray<FString> balances;
+    // pairs without a balance yet
+    int32 pending;
+    bool finished;
+    Callback callback;
+
+    void fetch(int32 start, int32 count, int32 attempt);
+    void onChunk(int32 start, int32 count, int32 attempt,
+                 TSharedPtr<FJsonValue> result, const FString &error);
+    void finish(const FString &error);
+
+    // balanceOfBatch calldata of the pairs at [start, start + count)
+    FString encode(int32 start, int32 count) const;
+
+    // uint256[] return data as decimal strings, throws unless count long
+    static TArray<FString> decode(const FString &returndata, int32 count);
+};
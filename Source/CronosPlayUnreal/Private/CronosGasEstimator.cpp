@@ -0,0 +1,141 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosGasEstimator.h"
+
+#include <stdexcept>
+
+#include "CronosAbi.h"
+
+static std::mutex estimatorsmutex;
+static TMap<FString, TSharedRef<CronosGasEstimator, ESPMode::ThreadSafe>>
+    estimators;
+
+CronosGasEstimator::CronosGasEstimator(
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher)
+    : batcher(rpcbatcher), margin(0.2f) {}
+
+TSharedRef<CronosGasEstimator, ESPMode::ThreadSafe>
+CronosGasEstimator::forEndpoint(const FString &rpcurl) {
+    std::lock_guard<std::mutex> lock(estimatorsmutex);
+    TSharedRef<CronosGasEstimator, ESPMode::ThreadSafe> *found =
+        estimators.Find(rpcurl);
+    if (found != NULL) {
+        return *found;
+    }
+    TSharedRef<CronosGasEstimator, ESPMode::ThreadSafe> estimator =
+        MakeShared<CronosGasEstimator, ESPMode::ThreadSafe>(
+            CronosRpcBatcher::forEndpoint(rpcurl));
+    estimators.Add(rpcurl, estimator);
+    return estimator;
+}
+
+void CronosGasEstimator::setMargin(float newmargin) {
+    std::lock_guard<std::mutex> lock(mutex);
+    margin = FMath::Max(0.0f, newmargin);
+}
+
+FString CronosGasEstimator::callKey(const FString &to,
+                                    const TArray<uint8> &data) {
+    // plain transfers have no selector
+    int32 selectorlength = FMath::Min(data.Num(), 4);
+    return to.ToLower() + TEXT(":") +
+           CronosAbi::bytesToHex(data.GetData(), selectorlength);
+}
+
+uint64 CronosGasEstimator::withMargin(uint64 gas) {
+    // caller holds mutex
+    return gas + (uint64)((double)gas * margin);
+}
+
+uint64 CronosGasEstimator::estimate(const FString &from, const FString &to,
+                                    const FString &value,
+                                    const TArray<uint8> &data,
+                                    FString &error) {
+    FString key = callKey(to, data);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Learned *found = learned.Find(key);
+        if (found != NULL && !found->stale) {
+            error = TEXT("");
+            return withMargin(FMath::Max(found->estimated, found->maxused));
+        }
+    }
+
+    FString call = FString::Printf(TEXT("{\"from\":\"%s\",\"to\":\"%s\""),
+                                   *from, *to);
+    if (!value.IsEmpty()) {
+        call += FString::Printf(TEXT(",\"value\":\"%s\""), *value);
+    }
+    if (data.Num() > 0) {
+        call += FString::Printf(
+            TEXT(",\"data\":\"0x%s\""),
+            *CronosAbi::bytesToHex(data.GetData(), data.Num()));
+    }
+    call += TEXT("}");
+    TSharedPtr<FJsonValue> result = batcher->callBlocking(
+        TEXT("eth_estimateGas"), FString::Printf(TEXT("[%s]"), *call), error);
+    if (!error.IsEmpty()) {
+        return 0;
+    }
+
+    FString hexnumber;
+    uint64 gas = 0;
+    try {
+        if (result.IsValid() && result->TryGetString(hexnumber)) {
+            gas = CronosAbi::toUint64(hexnumber);
+        }
+    } catch (const std::exception &) {
+        gas = 0;
+    }
+    if (gas == 0) {
+        error = TEXT("Invalid eth_estimateGas response");
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    // receipts seen before stay a floor
+    Learned &entry = learned.FindOrAdd(key, Learned{0, 0, false});
+    entry.estimated = gas;
+    entry.stale = false;
+    return withMargin(FMath::Max(entry.estimated, entry.maxused));
+}
+
+void CronosGasEstimator::learn(const FString &to, const TArray<uint8> &data,
+                               uint64 gasused, bool succeeded) {
+    if (gasused == 0) {
+        return;
+    }
+    FString key = callKey(to, data);
+    std::lock_guard<std::mutex> lock(mutex);
+    Learned &entry = learned.FindOrAdd(key, Learned{0, 0, false});
+    if (!succeeded) {
+        // maybe out of gas, estimate live on the next send
+        entry.stale = true;
+        return;
+    }
+    entry.maxused = FMath::Max(entry.maxused, gasused);
+}
+
+void CronosGasEstimator::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    learned.Empty();
+}
+
+bool CronosGasEstimator::isAuto(const FString &gaslimit) {
+    return gaslimit.Equals(TEXT("auto"), ESearchCase::IgnoreCase);
+}
+
+FString CronosGasEstimator::resolve(const FString &gaslimit,
+                                    const FString &from, const FString &to,
+                                    const FString &value,
+                                    const TArray<uint8> &data) {
+    if (!isAuto(gaslimit)) {
+        return gaslimit;
+    }
+    FString error;
+    uint64 gas = estimate(from, to, value, data, error);
+    if (!error.IsEmpty()) {
+        throw std::runtime_error(TCHAR_TO_UTF8(*error));
+    }
+    return FString::Printf(TEXT("%llu"), gas);
+}
@@ -0,0 +1,80 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "CronosRpcBatcher.h"
+#include <mutex>
+
+/**
+ * learned gas limits of one cronos evm endpoint
+ * eth_estimateGas runs once per (contract, 4 bytes selector), later sends of
+ * the same call reuse the estimate plus a safety margin, raised to the most
+ * gas any of their receipts used, never below the latest estimate
+ * all methods are thread-safe
+ */
+class CronosGasEstimator
+    : public TSharedFromThis<CronosGasEstimator, ESPMode::ThreadSafe> {
+  public:
+    explicit CronosGasEstimator(
+        TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher);
+
+    /**
+     * shared estimator of an endpoint, created on first use
+     */
+    static TSharedRef<CronosGasEstimator, ESPMode::ThreadSafe>
+    forEndpoint(const FString &rpcurl);
+
+    // extra gas on top of the estimate, 0.2 means +20%
+    void setMargin(float margin);
+
+    /**
+     * gas limit of a call, with the margin
+     * a learned estimate is served at once, otherwise a worker thread waits
+     * for eth_estimateGas, the game thread gets an error
+     * @param value amount in wei as 0x quantity, "" for none
+     * @param error "" if succeed
+     */
+    uint64 estimate(const FString &from, const FString &to,
+                    const FString &value, const TArray<uint8> &data,
+                    FString &error);
+
+    /**
+     * learn from the receipt of a sent call
+     * the learned gas is the max used by any receipt of the call, a failed
+     * call makes the next send estimate again
+     */
+    void learn(const FString &to, const TArray<uint8> &data, uint64 gasused,
+               bool succeeded);
+
+    // forget every learned estimate
+    void clear();
+
+    // "auto"
+    static bool isAuto(const FString &gaslimit);
+
+    /**
+     * decimal gas limit for a send, gaslimit is returned as is unless it is
+     * "auto", throws std::runtime_error if no estimate is available
+     */
+    FString resolve(const FString &gaslimit, const FString &from,
+                    const FString &to, const FString &value,
+                    const TArray<uint8> &data);
+
+  private:
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher;
+    std::mutex mutex;
+    struct Learned {
+        // latest eth_estimateGas result, 0 if never estimated
+        uint64 estimated;
+        // max gas used by a receipt
+        uint64 maxused;
+        // a call failed, estimate again on the next send
+        bool stale;
+    };
+    // "lowercase contract:selector" -> learned gas, without the margin
+    TMap<FString, Learned> learned;
+    float margin;
+
+    static FString callKey(const FString &to, const TArray<uint8> &data);
+    uint64 withMargin(uint64 gas);
+};
@@ -0,0 +1,234 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosGasOracle.h"
+
+#include <stdexcept>
+
+#include "CronosAbi.h"
+
+const int32 CronosGasOracle::Percentiles[CronosGasOracle::PercentileCount] = {
+    10, 25, 50, 75, 90};
+
+// blocks of eth_feeHistory to sample
+static const TCHAR *FeeHistoryBlocks = TEXT("0x14");
+
+static std::mutex oraclesmutex;
+static TMap<FString, TSharedRef<CronosGasOracle, ESPMode::ThreadSafe>>
+    oracles;
+
+// hex quantity json value, 0 if missing or invalid
+static uint64 gasQuantity(const TSharedPtr<FJsonValue> &value) {
+    FString hexnumber;
+    if (!value.IsValid() || !value->TryGetString(hexnumber)) {
+        return 0;
+    }
+    try {
+        return CronosAbi::toUint64(hexnumber);
+    } catch (const std::exception &) {
+        return 0;
+    }
+}
+
+CronosGasOracle::CronosGasOracle(
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher)
+    : batcher(rpcbatcher), updated(0.0), ttl(5.0f), expired(false),
+      refreshing(false) {
+    FMemory::Memzero(prices, sizeof(prices));
+}
+
+TSharedRef<CronosGasOracle, ESPMode::ThreadSafe>
+CronosGasOracle::forEndpoint(const FString &rpcurl) {
+    std::lock_guard<std::mutex> lock(oraclesmutex);
+    TSharedRef<CronosGasOracle, ESPMode::ThreadSafe> *found =
+        oracles.Find(rpcurl);
+    if (found != NULL) {
+        return *found;
+    }
+    TSharedRef<CronosGasOracle, ESPMode::ThreadSafe> oracle =
+        MakeShared<CronosGasOracle, ESPMode::ThreadSafe>(
+            CronosRpcBatcher::forEndpoint(rpcurl));
+    oracles.Add(rpcurl, oracle);
+    return oracle;
+}
+
+void CronosGasOracle::setTtl(float seconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ttl = FMath::Max(0.0f, seconds);
+}
+
+void CronosGasOracle::invalidate() {
+    std::lock_guard<std::mutex> lock(mutex);
+    expired = true;
+}
+
+void CronosGasOracle::refresh() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (refreshing) {
+            return;
+        }
+        refreshing = true;
+    }
+
+    // both calls go out in one batch, callbacks run on the game thread so
+    // the sample needs no lock
+    struct Sample {
+        TSharedPtr<FJsonValue> gasprice;
+        TSharedPtr<FJsonValue> feehistory;
+        int32 remaining = 2;
+    };
+    TSharedRef<Sample, ESPMode::ThreadSafe> sample =
+        MakeShared<Sample, ESPMode::ThreadSafe>();
+    TWeakPtr<CronosGasOracle, ESPMode::ThreadSafe> weakself = AsShared();
+    auto done = [weakself, sample]() {
+        if (--sample->remaining > 0) {
+            return;
+        }
+        TSharedPtr<CronosGasOracle, ESPMode::ThreadSafe> self = weakself.Pin();
+        if (self.IsValid()) {
+            self->update(sample->gasprice, sample->feehistory);
+        }
+    };
+
+    batcher->call(TEXT("eth_gasPrice"), TEXT("[]"),
+                  [sample, done](TSharedPtr<FJsonValue> result,
+                                 FString error) {
+                      if (error.IsEmpty()) {
+                          sample->gasprice = result;
+                      }
+                      done();
+                  });
+
+    TArray<FString> percentiles;
+    for (int32 percentile : Percentiles) {
+        percentiles.Add(FString::FromInt(percentile));
+    }
+    batcher->call(TEXT("eth_feeHistory"),
+                  FString::Printf(TEXT("[\"%s\",\"latest\",[%s]]"),
+                                  FeeHistoryBlocks,
+                                  *FString::Join(percentiles, TEXT(","))),
+                  [sample, done](TSharedPtr<FJsonValue> result,
+                                 FString error) {
+                      // not every node serves eth_feeHistory
+                      if (error.IsEmpty()) {
+                          sample->feehistory = result;
+                      }
+                      done();
+                  });
+}
+
+void CronosGasOracle::update(TSharedPtr<FJsonValue> gasprice,
+                             TSharedPtr<FJsonValue> feehistory) {
+    uint64 suggested = gasQuantity(gasprice);
+    uint64 sampled[PercentileCount];
+    bool hashistory = false;
+
+    const TSharedPtr<FJsonObject> *history = NULL;
+    const TArray<TSharedPtr<FJsonValue>> *basefees = NULL;
+    const TArray<TSharedPtr<FJsonValue>> *rewards = NULL;
+    if (feehistory.IsValid() && feehistory->TryGetObject(history) &&
+        (*history)->TryGetArrayField(TEXT("baseFeePerGas"), basefees) &&
+        (*history)->TryGetArrayField(TEXT("reward"), rewards) &&
+        basefees->Num() > 0 && rewards->Num() > 0) {
+        // the last base fee is the one of the next block
+        uint64 basefee = gasQuantity(basefees->Last());
+        hashistory = true;
+        for (int32 i = 0; i < PercentileCount; i++) {
+            // median over the sampled blocks of this percentile's tip
+            TArray<uint64> tips;
+            tips.Reserve(rewards->Num());
+            for (const TSharedPtr<FJsonValue> &reward : *rewards) {
+                const TArray<TSharedPtr<FJsonValue>> *blocktips = NULL;
+                if (reward.IsValid() && reward->TryGetArray(blocktips) &&
+                    blocktips->Num() == PercentileCount) {
+                    tips.Add(gasQuantity((*blocktips)[i]));
+                }
+            }
+            if (tips.Num() == 0) {
+                hashistory = false;
+                break;
+            }
+            tips.Sort();
+            sampled[i] = basefee + tips[tips.Num() / 2];
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    refreshing = false;
+    if (hashistory) {
+        FMemory::Memcpy(prices, sampled, sizeof(prices));
+    } else if (suggested > 0) {
+        for (int32 i = 0; i < PercentileCount; i++) {
+            prices[i] = suggested;
+        }
+    } else {
+        // keep the old sample, retried on the next read
+        return;
+    }
+    updated = FPlatformTime::Seconds();
+    expired = false;
+}
+
+int32 CronosGasOracle::percentileIndex(int32 percentile) {
+    int32 nearest = 0;
+    for (int32 i = 1; i < PercentileCount; i++) {
+        if (FMath::Abs(Percentiles[i] - percentile) <
+            FMath::Abs(Percentiles[nearest] - percentile)) {
+            nearest = i;
+        }
+    }
+    return nearest;
+}
+
+uint64 CronosGasOracle::getGasPrice(int32 percentile, FString &error) {
+    int32 index = percentileIndex(percentile);
+    uint64 price = 0;
+    bool stale = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        price = prices[index];
+        stale = expired || updated <= 0.0 ||
+                FPlatformTime::Seconds() - updated > ttl;
+    }
+    if (stale) {
+        refresh();
+    }
+    if (price > 0) {
+        error = TEXT("");
+        return price;
+    }
+
+    // no sample yet
+    TSharedPtr<FJsonValue> result =
+        batcher->callBlocking(TEXT("eth_gasPrice"), TEXT("[]"), error);
+    if (!error.IsEmpty()) {
+        return 0;
+    }
+    price = gasQuantity(result);
+    if (price == 0) {
+        error = TEXT("Invalid eth_gasPrice response");
+    }
+    return price;
+}
+
+bool CronosGasOracle::isAuto(const FString &gasprice) {
+    return gasprice.Equals(TEXT("auto"), ESearchCase::IgnoreCase) ||
+           gasprice.StartsWith(TEXT("auto:"), ESearchCase::IgnoreCase);
+}
+
+FString CronosGasOracle::resolve(const FString &gasprice) {
+    if (!isAuto(gasprice)) {
+        return gasprice;
+    }
+    int32 percentile = 50;
+    if (gasprice.Len() > 5) {
+        percentile = FCString::Atoi(*gasprice.RightChop(5));
+    }
+
+    FString error;
+    uint64 price = getGasPrice(percentile, error);
+    if (!error.IsEmpty()) {
+        throw std::runtime_error(TCHAR_TO_UTF8(*error));
+    }
+    return FString::Printf(TEXT("%llu"), price);
+}
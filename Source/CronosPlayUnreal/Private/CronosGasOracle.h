@@ -0,0 +1,71 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "CronosRpcBatcher.h"
+#include <mutex>
+
+/**
+ * cached gas price of one cronos evm endpoint
+ * eth_gasPrice and eth_feeHistory are sampled together at most once per ttl
+ * (or per block, with invalidate() on a new block), so every send can price
+ * itself without its own round trip
+ * all methods are thread-safe
+ */
+class CronosGasOracle
+    : public TSharedFromThis<CronosGasOracle, ESPMode::ThreadSafe> {
+  public:
+    // sampled reward percentiles of eth_feeHistory
+    static constexpr int32 PercentileCount = 5;
+    static const int32 Percentiles[PercentileCount];
+
+    explicit CronosGasOracle(
+        TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher);
+
+    /**
+     * shared oracle of an endpoint, created on first use
+     */
+    static TSharedRef<CronosGasOracle, ESPMode::ThreadSafe>
+    forEndpoint(const FString &rpcurl);
+
+    // seconds a sample stays fresh
+    void setTtl(float seconds);
+
+    // mark the sample stale, e.g. on a new block, the cached price is still
+    // served until the next sample lands
+    void invalidate();
+
+    // sample again in the background, no-op if a sample is in flight
+    void refresh();
+
+    /**
+     * gas price in wei at the nearest sampled percentile, 50 is the median
+     * a stale price is served while a new sample is taken in the background
+     * without any sample yet, a worker thread waits for eth_gasPrice, the
+     * game thread gets an error
+     * @param error "" if succeed
+     */
+    uint64 getGasPrice(int32 percentile, FString &error);
+
+    // "auto" or "auto:<percentile>", e.g. "auto:90"
+    static bool isAuto(const FString &gasprice);
+
+    /**
+     * decimal gas price in wei for a send, gasprice is returned as is unless
+     * it is "auto", throws std::runtime_error if no price is available
+     */
+    FString resolve(const FString &gasprice);
+
+  private:
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher;
+    std::mutex mutex;
+    uint64 prices[PercentileCount];
+    double updated;
+    float ttl;
+    bool expired;
+    bool refreshing;
+
+    static int32 percentileIndex(int32 percentile);
+    void update(TSharedPtr<FJsonValue> gasprice,
+                TSharedPtr<FJsonValue> feehistory);
+};
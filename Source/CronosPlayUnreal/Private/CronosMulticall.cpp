@@ -0,0 +1,119 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosMulticall.h"
+
+#include <stdexcept>
+
+#include "CronosAbi.h"
+
+FString CronosMulticall::encodeCall(const FCronosMulticallItem &item) {
+    switch (item.Function) {
+    case ECronosMulticallFunction::Raw:
+        return CronosAbi::stripHex(item.CallData);
+    case ECronosMulticallFunction::BalanceOf:
+        return CronosAbi::BalanceOf + CronosAbi::encodeAddress(item.Account);
+    case ECronosMulticallFunction::Erc1155BalanceOf:
+        return CronosAbi::Erc1155BalanceOf +
+               CronosAbi::encodeAddress(item.Account) +
+               CronosAbi::encodeUint256(item.TokenID);
+    case ECronosMulticallFunction::OwnerOf:
+        return CronosAbi::OwnerOf + CronosAbi::encodeUint256(item.TokenID);
+    case ECronosMulticallFunction::TokenURI:
+        return CronosAbi::TokenURI + CronosAbi::encodeUint256(item.TokenID);
+    case ECronosMulticallFunction::Uri:
+        return CronosAbi::Uri + CronosAbi::encodeUint256(item.TokenID);
+    case ECronosMulticallFunction::Allowance:
+        return CronosAbi::Allowance + CronosAbi::encodeAddress(item.Account) +
+               CronosAbi::encodeAddress(item.Operator);
+    case ECronosMulticallFunction::IsApprovedForAll:
+        return CronosAbi::IsApprovedForAll +
+               CronosAbi::encodeAddress(item.Account) +
+               CronosAbi::encodeAddress(item.Operator);
+    case ECronosMulticallFunction::Decimals:
+        return CronosAbi::Decimals;
+    case ECronosMulticallFunction::TotalSupply:
+        return CronosAbi::TotalSupply;
+    case ECronosMulticallFunction::Name:
+        return CronosAbi::Name;
+    case ECronosMulticallFunction::Symbol:
+        return CronosAbi::Symbol;
+    }
+    throw std::runtime_error("Invalid multicall function");
+}
+
+FString
+CronosMulticall::encodeAggregate3(const TArray<FCronosMulticallItem> &items) {
+    // Call3 tuples are dynamic, so the array holds their offsets followed by
+    // the tuples: target, allowFailure, offset of callData, callData
+    FString heads;
+    FString tails;
+    int64 offset = (int64)items.Num() * 32;
+    for (const FCronosMulticallItem &item : items) {
+        FString tuple = CronosAbi::encodeAddress(item.ContractAddress) +
+                        CronosAbi::encodeSize(1) + CronosAbi::encodeSize(96) +
+                        CronosAbi::encodeBytes(encodeCall(item));
+        heads += CronosAbi::encodeSize(offset);
+        offset += tuple.Len() / 2;
+        tails += tuple;
+    }
+    return Aggregate3 + CronosAbi::encodeSize(32) +
+           CronosAbi::encodeSize(items.Num()) + heads + tails;
+}
+
+TArray<FCronosMulticallResult>
+CronosMulticall::decodeAggregate3(const FString &returndata,
+                                  const TArray<FCronosMulticallItem> &items) {
+    // Result[]: offset of array, length, offsets of the tuples, tuples of
+    // success and returnData
+    FString data = CronosAbi::stripHex(returndata);
+    int64 array = CronosAbi::sizeAt(data, 0);
+    int64 count = CronosAbi::sizeAt(data, array);
+    if (count != items.Num()) {
+        throw std::runtime_error("Multicall result count mismatch");
+    }
+    int64 elements = array + 32;
+
+    TArray<FCronosMulticallResult> results;
+    results.SetNum(items.Num());
+    for (int32 i = 0; i < items.Num(); i++) {
+        int64 tuple =
+            elements + CronosAbi::sizeAt(data, elements + (int64)i * 32);
+        FCronosMulticallResult &result = results[i];
+        int64 bytes = tuple + CronosAbi::sizeAt(data, tuple + 32);
+        result.Success = CronosAbi::sizeAt(data, tuple) != 0;
+        result.ReturnData = TEXT("0x") + CronosAbi::bytesAt(data, bytes);
+        if (result.Success) {
+            try {
+                result.Value =
+                    decodeValue(items[i].Function, result.ReturnData);
+            } catch (const std::exception &) {
+                // e.g. empty return data of an address without code
+                result.Success = false;
+            }
+        }
+    }
+    return results;
+}
+
+FString CronosMulticall::decodeValue(ECronosMulticallFunction function,
+                                     const FString &returndata) {
+    switch (function) {
+    case ECronosMulticallFunction::BalanceOf:
+    case ECronosMulticallFunction::Erc1155BalanceOf:
+    case ECronosMulticallFunction::Allowance:
+    case ECronosMulticallFunction::Decimals:
+    case ECronosMulticallFunction::TotalSupply:
+        return CronosAbi::decodeUint256(returndata);
+    case ECronosMulticallFunction::OwnerOf:
+        return CronosAbi::decodeAddress(returndata);
+    case ECronosMulticallFunction::TokenURI:
+    case ECronosMulticallFunction::Uri:
+    case ECronosMulticallFunction::Name:
+    case ECronosMulticallFunction::Symbol:
+        return CronosAbi::decodeString(returndata);
+    case ECronosMulticallFunction::IsApprovedForAll:
+        return CronosAbi::decodeBool(returndata) ? TEXT("true") : TEXT("false");
+    default:
+        return returndata;
+    }
+}
@@ -0,0 +1,36 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "DefiWalletCoreActor.h"
+
+/**
+ * Multicall3 aggregate3 encoding, packs many contract reads into one eth_call
+ * https://github.com/mds1/multicall
+ * hex strings are without 0x unless noted, invalid input throws
+ * std::runtime_error
+ */
+class CronosMulticall {
+  public:
+    // Multicall3 is deployed at the same address on most evm chains
+    static constexpr const TCHAR *DefaultAddress =
+        TEXT("0xcA11bde05977b3631167028862bE2a173976CA11");
+
+    // aggregate3((address,bool,bytes)[])
+    static constexpr const TCHAR *Aggregate3 = TEXT("82ad56cb");
+
+    // calldata of one item
+    static FString encodeCall(const FCronosMulticallItem &item);
+
+    // aggregate3 calldata, every call is allowed to fail
+    static FString encodeAggregate3(const TArray<FCronosMulticallItem> &items);
+
+    // results of aggregate3, in the order of items
+    static TArray<FCronosMulticallResult>
+    decodeAggregate3(const FString &returndata,
+                     const TArray<FCronosMulticallItem> &items);
+
+    // value of the return data (0x hex) of a successful call
+    static FString decodeValue(ECronosMulticallFunction function,
+                               const FString &returndata);
+};
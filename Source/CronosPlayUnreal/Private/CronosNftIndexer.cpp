@@ -0,0 +1,333 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosNftIndexer.h"
+
+#include "CronosAbi.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static std::mutex indexersmutex;
+static TMap<FString, TSharedRef<CronosNftIndexer, ESPMode::ThreadSafe>>
+    indexers;
+
+// first line of the checkpoint file
+static const TCHAR *NftCheckpointMagic = TEXT("CronosPlayUnreal nft index 1");
+// seconds between checkpoints while backfilling
+static const double NftCheckpointInterval = 30.0;
+static const TCHAR *NftZeroAddress =
+    TEXT("0x0000000000000000000000000000000000000000");
+// max blocks between retries of a failing eth_getLogs
+static const int32 NftMaxBackoffBlocks = 64;
+
+CronosNftIndexer::CronosNftIndexer(
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher,
+    TSharedRef<CronosBlockClock, ESPMode::ThreadSafe> blockclock)
+    : batcher(rpcbatcher), clock(blockclock), head(0), chunksize(2000),
+      dirty(false), lastsave(0) {}
+
+TSharedRef<CronosNftIndexer, ESPMode::ThreadSafe>
+CronosNftIndexer::forEndpoint(const FString &rpcurl) {
+    std::lock_guard<std::mutex> lock(indexersmutex);
+    TSharedRef<CronosNftIndexer, ESPMode::ThreadSafe> *found =
+        indexers.Find(rpcurl);
+    if (found != NULL) {
+        return *found;
+    }
+    TSharedRef<CronosNftIndexer, ESPMode::ThreadSafe> indexer =
+        MakeShared<CronosNftIndexer, ESPMode::ThreadSafe>(
+            CronosRpcBatcher::forEndpoint(rpcurl),
+            CronosBlockClock::forEndpoint(rpcurl));
+    indexers.Add(rpcurl, indexer);
+    return indexer;
+}
+
+void CronosNftIndexer::setChunkSize(int32 blocks) {
+    std::lock_guard<std::mutex> lock(mutex);
+    chunksize = FMath::Max(1, blocks);
+}
+
+void CronosNftIndexer::setCheckpointFile(const FString &path) {
+    if (path == checkpointpath) {
+        return;
+    }
+    save();
+    checkpointpath = path;
+    load();
+}
+
+void CronosNftIndexer::addContract(const FString &contract,
+                                   uint64 fromblock) {
+    FString address = CronosAbi::normalizeAddress(contract);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!contracts.Contains(address)) {
+            ContractIndex &index = contracts.Add(address);
+            index.nextblock = fromblock;
+            index.chunk = chunksize;
+            dirty = true;
+        }
+    }
+    if (!clockhandle.IsValid()) {
+        clockhandle =
+            clock->subscribe(CronosBlockClock::FOnBlock::FDelegate::CreateSP(
+                this, &CronosNftIndexer::onBlock));
+    }
+    // the clock may know the head already
+    onBlock(clock->getBlockNumber());
+}
+
+void CronosNftIndexer::stop() {
+    if (clockhandle.IsValid()) {
+        clock->unsubscribe(clockhandle);
+        clockhandle.Reset();
+    }
+    save();
+}
+
+void CronosNftIndexer::onBlock(uint64 number) {
+    TArray<FString> addresses;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        head = FMath::Max(head, number);
+        contracts.GetKeys(addresses);
+    }
+    for (const FString &address : addresses) {
+        fetch(address);
+    }
+}
+
+void CronosNftIndexer::fetch(const FString &contract) {
+    uint64 from;
+    uint64 to;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ContractIndex *index = contracts.Find(contract);
+        if (index == NULL || index->fetching || head == 0 ||
+            index->nextblock > head || head < index->retryblock) {
+            return;
+        }
+        from = index->nextblock;
+        to = FMath::Min(from + (uint64)index->chunk - 1, head);
+        index->fetching = true;
+    }
+
+    FString params = FString::Printf(
+        TEXT("[{\"address\":\"%s\",\"topics\":[\"%s\"],"
+             "\"fromBlock\":\"0x%llx\",\"toBlock\":\"0x%llx\"}]"),
+        *contract, CronosAbi::TransferTopic, (unsigned long long)from,
+        (unsigned long long)to);
+    TWeakPtr<CronosNftIndexer, ESPMode::ThreadSafe> weakself = AsShared();
+    batcher->call(TEXT("eth_getLogs"), params,
+                  [weakself, contract, from, to](TSharedPtr<FJsonValue> result,
+                                                 FString error) {
+                      TSharedPtr<CronosNftIndexer, ESPMode::ThreadSafe> self =
+                          weakself.Pin();
+                      if (self.IsValid()) {
+                          self->onLogs(contract, from, to, result, error);
+                      }
+                  });
+}
+
+void CronosNftIndexer::onLogs(const FString &contract, uint64 from,
+                              uint64 to, TSharedPtr<FJsonValue> result,
+                              const FString &error) {
+    const TArray<TSharedPtr<FJsonValue>> *logs = NULL;
+    FString logerror = error;
+    if (logerror.IsEmpty() && !result->TryGetArray(logs)) {
+        logerror = TEXT("Invalid eth_getLogs result");
+    }
+
+    bool more = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ContractIndex *index = contracts.Find(contract);
+        if (index == NULL) {
+            return;
+        }
+        index->fetching = false;
+        if (!logerror.IsEmpty()) {
+            UE_LOG(LogTemp, Warning,
+                   TEXT("CronosNftIndexer %s blocks %llu-%llu: %s"),
+                   *contract, from, to, *logerror);
+            if (index->chunk > 1 && isRangeError(logerror)) {
+                // most nodes cap the range or the result size, retry
+                // smaller right away
+                index->chunk = FMath::Max(1, index->chunk / 2);
+                more = true;
+            } else {
+                // node down or rate limited, wait for later blocks
+                index->failures = FMath::Min(index->failures + 1, 7);
+                index->retryblock =
+                    head + FMath::Min(1 << (index->failures - 1),
+                                      NftMaxBackoffBlocks);
+            }
+        } else {
+            index->failures = 0;
+            index->retryblock = 0;
+            for (const TSharedPtr<FJsonValue> &log : *logs) {
+                const TSharedPtr<FJsonObject> *object = NULL;
+                const TArray<TSharedPtr<FJsonValue>> *topics = NULL;
+                bool removed = false;
+                if (!log->TryGetObject(object) ||
+                    !(*object)->TryGetArrayField(TEXT("topics"), topics) ||
+                    topics->Num() != 4 ||
+                    ((*object)->TryGetBoolField(TEXT("removed"), removed) &&
+                     removed)) {
+                    continue;
+                }
+                try {
+                    applyTransfer(
+                        *index,
+                        CronosAbi::decodeAddress((*topics)[1]->AsString()),
+                        CronosAbi::decodeAddress((*topics)[2]->AsString()),
+                        CronosAbi::toDecimal((*topics)[3]->AsString()));
+                } catch (const std::exception &e) {
+                    UE_LOG(LogTemp, Warning,
+                           TEXT("CronosNftIndexer invalid log: %s"),
+                           UTF8_TO_TCHAR(e.what()));
+                }
+            }
+            index->nextblock = to + 1;
+            // grow back after a refused range
+            index->chunk = FMath::Min(index->chunk * 2, chunksize);
+            dirty = true;
+            more = index->nextblock <= head;
+        }
+    }
+
+    if (more) {
+        fetch(contract);
+    } else if (FPlatformTime::Seconds() - lastsave >= NftCheckpointInterval) {
+        save();
+    }
+}
+
+bool CronosNftIndexer::isRangeError(const FString &error) {
+    // e.g. "query returned more than 10000 results", "block range is too
+    // wide", "exceed maximum block range: 2000", "log response size
+    // exceeded", but not "rate limit exceeded"
+    static const TCHAR *Markers[] = {TEXT("range"), TEXT("too many"),
+                                     TEXT("more than"),
+                                     TEXT("response size"),
+                                     TEXT("too large")};
+    for (const TCHAR *marker : Markers) {
+        if (error.Contains(marker)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CronosNftIndexer::applyTransfer(ContractIndex &index,
+                                     const FString &from, const FString &to,
+                                     const FString &tokenid) {
+    FString owner = to.ToLower();
+    TSet<FString> *previous = index.tokens.Find(from.ToLower());
+    if (previous != NULL) {
+        previous->Remove(tokenid);
+        if (previous->Num() == 0) {
+            index.tokens.Remove(from.ToLower());
+        }
+    }
+    if (owner == NftZeroAddress) {
+        // burned
+        index.owners.Remove(tokenid);
+        return;
+    }
+    index.owners.Add(tokenid, owner);
+    index.tokens.FindOrAdd(owner).Add(tokenid);
+}
+
+TArray<FString> CronosNftIndexer::getTokens(const FString &contract,
+                                            const FString &owner,
+                                            bool &synced) {
+    std::lock_guard<std::mutex> lock(mutex);
+    synced = false;
+    ContractIndex *index = contracts.Find(contract.ToLower());
+    if (index == NULL) {
+        return TArray<FString>();
+    }
+    synced = head > 0 && index->nextblock > head;
+    TSet<FString> *owned = index->tokens.Find(owner.ToLower());
+    return owned != NULL ? owned->Array() : TArray<FString>();
+}
+
+FString CronosNftIndexer::getOwner(const FString &contract,
+                                   const FString &tokenid) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ContractIndex *index = contracts.Find(contract.ToLower());
+    if (index == NULL) {
+        return FString();
+    }
+    FString *owner = index->owners.Find(tokenid);
+    return owner != NULL ? *owner : FString();
+}
+
+void CronosNftIndexer::save() {
+    FString text;
+    FString path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (checkpointpath.IsEmpty() || !dirty) {
+            return;
+        }
+        // C <contract> <next block>, then T <contract> <token id> <owner>
+        text = NftCheckpointMagic;
+        text += TEXT("\n");
+        for (const TPair<FString, ContractIndex> &contract : contracts) {
+            text += FString::Printf(TEXT("C %s %llu\n"), *contract.Key,
+                                    contract.Value.nextblock);
+            for (const TPair<FString, FString> &owner :
+                 contract.Value.owners) {
+                text += FString::Printf(TEXT("T %s %s %s\n"), *contract.Key,
+                                        *owner.Key, *owner.Value);
+            }
+        }
+        path = checkpointpath;
+        dirty = false;
+        lastsave = FPlatformTime::Seconds();
+    }
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(path), true);
+    if (!FFileHelper::SaveStringToFile(text, *path)) {
+        UE_LOG(LogTemp, Warning,
+               TEXT("CronosPlayUnreal failed to save nft index %s"), *path);
+    }
+}
+
+void CronosNftIndexer::load() {
+    FString text;
+    if (!FFileHelper::LoadFileToString(text, *checkpointpath)) {
+        return;
+    }
+    TArray<FString> lines;
+    text.ParseIntoArrayLines(lines);
+    if (lines.Num() == 0 || lines[0] != NftCheckpointMagic) {
+        UE_LOG(LogTemp, Warning,
+               TEXT("CronosPlayUnreal nft index %s is not readable"),
+               *checkpointpath);
+        return;
+    }
+
+    TMap<FString, ContractIndex> loaded;
+    for (int32 i = 1; i < lines.Num(); i++) {
+        TArray<FString> fields;
+        lines[i].ParseIntoArrayWS(fields);
+        if (fields.Num() == 3 && fields[0] == TEXT("C")) {
+            ContractIndex &index = loaded.FindOrAdd(fields[1]);
+            index.nextblock = FCString::Strtoui64(*fields[2], NULL, 10);
+        } else if (fields.Num() == 4 && fields[0] == TEXT("T")) {
+            applyTransfer(loaded.FindOrAdd(fields[1]), NftZeroAddress,
+                          fields[3], fields[2]);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (TPair<FString, ContractIndex> &contract : loaded) {
+        // contracts added before the file was loaded keep their progress
+        if (!contracts.Contains(contract.Key)) {
+            contract.Value.chunk = chunksize;
+            contracts.Add(contract.Key, MoveTemp(contract.Value));
+        }
+    }
+}
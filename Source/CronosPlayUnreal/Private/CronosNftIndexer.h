@@ -0,0 +1,104 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "CronosBlockClock.h"
+#include "CronosRpcBatcher.h"
+#include <mutex>
+
+/**
+ * erc-721 ownership index of a set of contracts, built from their
+ * Transfer(address,address,uint256) logs: backfilled with chunked
+ * eth_getLogs from a start block, then followed with the block clock of the
+ * endpoint, so enumerable and non-enumerable contracts both work and
+ * inventory lookups don't touch the network
+ * erc-20 Transfer logs (value not indexed) are ignored
+ * the index is checkpointed to a file and resumed from it
+ * lookups are thread-safe, the rest is game thread only
+ */
+class CronosNftIndexer
+    : public TSharedFromThis<CronosNftIndexer, ESPMode::ThreadSafe> {
+  public:
+    CronosNftIndexer(
+        TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher,
+        TSharedRef<CronosBlockClock, ESPMode::ThreadSafe> blockclock);
+
+    /**
+     * shared indexer of an endpoint, created on first use
+     */
+    static TSharedRef<CronosNftIndexer, ESPMode::ThreadSafe>
+    forEndpoint(const FString &rpcurl);
+
+    /**
+     * max blocks per eth_getLogs, halved while the node refuses the range or
+     * the result size, other errors are retried after 1, 2, 4 .. 64 blocks
+     */
+    void setChunkSize(int32 blocks);
+
+    /**
+     * load the checkpoint file and save to it from now on, the contracts in
+     * it resume after their last indexed block
+     * no-op if path is already the checkpoint file
+     */
+    void setCheckpointFile(const FString &path);
+
+    /**
+     * index contract from fromblock and follow new blocks
+     * no-op if contract is already indexed (or resumed from the checkpoint)
+     * throws if contract is not an address
+     */
+    void addContract(const FString &contract, uint64 fromblock);
+
+    // stop following new blocks and save the checkpoint
+    void stop();
+
+    // write the checkpoint file if the index changed
+    void save();
+
+    /**
+     * token ids owned by owner, in no particular order
+     * @param synced whether the index of contract has reached the chain head
+     */
+    TArray<FString> getTokens(const FString &contract, const FString &owner,
+                              bool &synced);
+
+    // owner of tokenid, "" if unknown or burned
+    FString getOwner(const FString &contract, const FString &tokenid);
+
+  private:
+    struct ContractIndex {
+        // first block not indexed yet
+        uint64 nextblock = 0;
+        int32 chunk = 0;
+        bool fetching = false;
+        // failed eth_getLogs in a row, no fetch before block retryblock
+        int32 failures = 0;
+        uint64 retryblock = 0;
+        // token id -> owner
+        TMap<FString, FString> owners;
+        // owner -> token ids
+        TMap<FString, TSet<FString>> tokens;
+    };
+
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher;
+    TSharedRef<CronosBlockClock, ESPMode::ThreadSafe> clock;
+    FDelegateHandle clockhandle;
+    std::mutex mutex;
+    // lowercase contract address -> index
+    TMap<FString, ContractIndex> contracts;
+    uint64 head;
+    int32 chunksize;
+    FString checkpointpath;
+    bool dirty;
+    double lastsave;
+
+    void onBlock(uint64 number);
+    void fetch(const FString &contract);
+    void onLogs(const FString &contract, uint64 from, uint64 to,
+                TSharedPtr<FJsonValue> result, const FString &error);
+    // the node refused the block range or the number of logs
+    static bool isRangeError(const FString &error);
+    static void applyTransfer(ContractIndex &index, const FString &from,
+                              const FString &to, const FString &tokenid);
+    void load();
+};
@@ -0,0 +1,295 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosReceiptWatcher.h"
+
+#include <stdexcept>
+
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "CronosAbi.h"
+#include "CronosBroadcastQueue.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+
+typedef TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>
+    CondensedJsonWriter;
+typedef TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>
+    CondensedJsonWriterFactory;
+
+static std::mutex watchersmutex;
+static TMap<FString, TSharedRef<CronosReceiptWatcher, ESPMode::ThreadSafe>>
+    watchers;
+
+// hex data field, empty if missing or null
+static TArray<uint8> receiptBytes(const TSharedPtr<FJsonObject> &receipt,
+                                  const TCHAR *name) {
+    FString value;
+    receipt->TryGetStringField(name, value);
+    return CronosAbi::hexToBytes(value);
+}
+
+// hex quantity field as decimal, "" if missing or null
+static FString receiptQuantity(const TSharedPtr<FJsonObject> &receipt,
+                               const TCHAR *name) {
+    FString value;
+    if (!receipt->TryGetStringField(name, value) || value.IsEmpty()) {
+        return TEXT("");
+    }
+    return CronosAbi::toDecimal(value);
+}
+
+CronosReceiptWatcher::CronosReceiptWatcher(
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher)
+    : batcher(rpcbatcher), pollinterval(1.0f), timeout(120.0f),
+      tickerscheduled(false) {}
+
+TSharedRef<CronosReceiptWatcher, ESPMode::ThreadSafe>
+CronosReceiptWatcher::forEndpoint(const FString &rpcurl) {
+    std::lock_guard<std::mutex> lock(watchersmutex);
+    TSharedRef<CronosReceiptWatcher, ESPMode::ThreadSafe> *found =
+        watchers.Find(rpcurl);
+    if (found != NULL) {
+        return *found;
+    }
+    TSharedRef<CronosReceiptWatcher, ESPMode::ThreadSafe> watcher =
+        MakeShared<CronosReceiptWatcher, ESPMode::ThreadSafe>(
+            CronosRpcBatcher::forEndpoint(rpcurl));
+    watchers.Add(rpcurl, watcher);
+    return watcher;
+}
+
+void CronosReceiptWatcher::setPollInterval(float seconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    pollinterval = FMath::Max(0.1f, seconds);
+}
+
+void CronosReceiptWatcher::setTimeout(float seconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    timeout = FMath::Max(1.0f, seconds);
+}
+
+void CronosReceiptWatcher::watch(const FString &txhash, Callback callback) {
+    FString key = txhash.ToLower();
+    std::lock_guard<std::mutex> lock(mutex);
+    PendingTx *found = pending.Find(key);
+    if (found != NULL) {
+        found->callbacks.Add(MoveTemp(callback));
+        return;
+    }
+    PendingTx tx;
+    tx.callbacks.Add(MoveTemp(callback));
+    tx.deadline = FPlatformTime::Seconds() + timeout;
+    tx.polling = false;
+    pending.Add(key, MoveTemp(tx));
+    scheduleTicker();
+}
+
+bool CronosReceiptWatcher::send(const TArray<uint8> &signedtx,
+                                SentCallback sent, Callback mined) {
+    TWeakPtr<CronosReceiptWatcher, ESPMode::ThreadSafe> weakself = AsShared();
+    // rate limited and retried by the queue
+    return CronosBroadcastQueue::forEndpoint(batcher->getUrl())
+        ->send(signedtx, [weakself, sent, mined](FString txhash,
+                                                 FString error) {
+            if (sent) {
+                sent(txhash, error);
+            }
+            TSharedPtr<CronosReceiptWatcher, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            if (error.IsEmpty() && mined && self.IsValid()) {
+                self->watch(txhash, mined);
+            }
+        });
+}
+
+void CronosReceiptWatcher::setBlockClock(
+    TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> clock) {
+    std::lock_guard<std::mutex> lock(mutex);
+    blockclock = clock;
+}
+
+void CronosReceiptWatcher::scheduleTicker() {
+    // caller holds mutex
+    if (tickerscheduled) {
+        return;
+    }
+    tickerscheduled = true;
+
+    TWeakPtr<CronosReceiptWatcher, ESPMode::ThreadSafe> weakself = AsShared();
+    AsyncTask(ENamedThreads::GameThread, [weakself]() {
+        TSharedPtr<CronosReceiptWatcher, ESPMode::ThreadSafe> self =
+            weakself.Pin();
+        if (self.IsValid()) {
+            self->startPolling();
+        }
+    });
+}
+
+void CronosReceiptWatcher::startPolling() {
+    TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> clock;
+    float interval;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        clock = blockclock;
+        interval = pollinterval;
+    }
+
+    TWeakPtr<CronosReceiptWatcher, ESPMode::ThreadSafe> weakself = AsShared();
+    if (clock.IsValid()) {
+        CronosBlockClock::FOnBlock::FDelegate blockdelegate =
+            CronosBlockClock::FOnBlock::FDelegate::CreateLambda(
+                [weakself](uint64 blocknumber) {
+                    TSharedPtr<CronosReceiptWatcher, ESPMode::ThreadSafe>
+                        self = weakself.Pin();
+                    if (self.IsValid()) {
+                        self->onPollTick();
+                    }
+                });
+        FDelegateHandle handle = clock->subscribe(blockdelegate);
+        std::lock_guard<std::mutex> lock(mutex);
+        pollclock = clock;
+        pollhandle = handle;
+        return;
+    }
+
+    FTickerDelegate polldelegate =
+        FTickerDelegate::CreateLambda([weakself](float deltatime) {
+            TSharedPtr<CronosReceiptWatcher, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            return self.IsValid() && self->onPollTick();
+        });
+#if ENGINE_MAJOR_VERSION == 4
+    FTicker::GetCoreTicker().AddTicker(polldelegate, interval);
+#else
+    FTSTicker::GetCoreTicker().AddTicker(polldelegate, interval);
+#endif
+}
+
+bool CronosReceiptWatcher::onPollTick() {
+    poll();
+
+    TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> clock;
+    FDelegateHandle handle;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pending.Num() > 0) {
+            return true;
+        }
+        // stop until the next watch()
+        tickerscheduled = false;
+        clock = pollclock;
+        handle = pollhandle;
+        pollclock.Reset();
+        pollhandle.Reset();
+    }
+    if (clock.IsValid()) {
+        clock->unsubscribe(handle);
+    }
+    return false;
+}
+
+void CronosReceiptWatcher::poll() {
+    TArray<FString> txhashes;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (TPair<FString, PendingTx> &tx : pending) {
+            // skip txs whose previous poll is still in flight
+            if (!tx.Value.polling) {
+                tx.Value.polling = true;
+                txhashes.Add(tx.Key);
+            }
+        }
+    }
+
+    // issued in the same frame, so the batcher sends them as one batch
+    TWeakPtr<CronosReceiptWatcher, ESPMode::ThreadSafe> weakself = AsShared();
+    for (const FString &txhash : txhashes) {
+        batcher->call(
+            TEXT("eth_getTransactionReceipt"),
+            FString::Printf(TEXT("[\"%s\"]"), *txhash),
+            [weakself, txhash](TSharedPtr<FJsonValue> result, FString error) {
+                TSharedPtr<CronosReceiptWatcher, ESPMode::ThreadSafe> self =
+                    weakself.Pin();
+                if (self.IsValid()) {
+                    self->complete(txhash, result, error);
+                }
+            });
+    }
+}
+
+void CronosReceiptWatcher::complete(const FString &txhash,
+                                    TSharedPtr<FJsonValue> result,
+                                    FString error) {
+    const TSharedPtr<FJsonObject> *receiptobject = NULL;
+    bool mined = error.IsEmpty() && result.IsValid() &&
+                 result->TryGetObject(receiptobject);
+
+    TArray<Callback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        PendingTx *tx = pending.Find(txhash);
+        if (tx == NULL) {
+            return;
+        }
+        tx->polling = false;
+        if (!mined && FPlatformTime::Seconds() < tx->deadline) {
+            // not mined yet, or a transient rpc error, poll again
+            return;
+        }
+        callbacks = MoveTemp(tx->callbacks);
+        pending.Remove(txhash);
+    }
+
+    FCronosTransactionReceiptRaw receipt;
+    if (mined) {
+        try {
+            receipt = toReceipt(*receiptobject);
+        } catch (const std::exception &e) {
+            error = UTF8_TO_TCHAR(e.what());
+        }
+    } else if (error.IsEmpty()) {
+        error = TEXT("Transaction receipt timeout, tx may be dropped");
+    }
+    for (Callback &callback : callbacks) {
+        callback(receipt, error);
+    }
+}
+
+int32 CronosReceiptWatcher::getPendingCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pending.Num();
+}
+
+FCronosTransactionReceiptRaw
+CronosReceiptWatcher::toReceipt(const TSharedPtr<FJsonObject> &receipt) {
+    if (!receipt.IsValid()) {
+        throw std::runtime_error("Invalid transaction receipt");
+    }
+    FCronosTransactionReceiptRaw ret;
+    ret.TransationHash = receiptBytes(receipt, TEXT("transactionHash"));
+    ret.BlockHash = receiptBytes(receipt, TEXT("blockHash"));
+    ret.BlockNumber = receiptQuantity(receipt, TEXT("blockNumber"));
+    ret.CumulativeGasUsed = receiptQuantity(receipt, TEXT("cumulativeGasUsed"));
+    ret.GasUsed = receiptQuantity(receipt, TEXT("gasUsed"));
+    receipt->TryGetStringField(TEXT("contractAddress"), ret.ContractAddress);
+    const TArray<TSharedPtr<FJsonValue>> *logs = NULL;
+    if (receipt->TryGetArrayField(TEXT("logs"), logs)) {
+        for (const TSharedPtr<FJsonValue> &log : *logs) {
+            const TSharedPtr<FJsonObject> *logobject = NULL;
+            if (!log->TryGetObject(logobject)) {
+                continue;
+            }
+            FString logjson;
+            TSharedRef<CondensedJsonWriter> writer =
+                CondensedJsonWriterFactory::Create(&logjson);
+            FJsonSerializer::Serialize(logobject->ToSharedRef(), writer);
+            ret.Logs.Add(logjson);
+        }
+    }
+    ret.Status = receiptQuantity(receipt, TEXT("status"));
+    ret.Root = receiptBytes(receipt, TEXT("root"));
+    ret.LogsBloom = receiptBytes(receipt, TEXT("logsBloom"));
+    ret.TransactionType = receiptQuantity(receipt, TEXT("type"));
+    ret.EffectiveGasPrice = receiptQuantity(receipt, TEXT("effectiveGasPrice"));
+    return ret;
+}
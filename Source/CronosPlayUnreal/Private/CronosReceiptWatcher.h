@@ -0,0 +1,100 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "CronosBlockClock.h"
+#include "CronosRpcBatcher.h"
+#include "DynamicContractObject.h"
+#include <mutex>
+
+/**
+ * tracks pending evm txs of one endpoint and polls all of their receipts
+ * together, one eth_getTransactionReceipt per tx in one json-rpc batch per
+ * poll interval (or per block with a block clock), instead of parking a
+ * worker thread per tx
+ * watch() and send() are thread-safe, callbacks run on the game thread
+ */
+class CronosReceiptWatcher
+    : public TSharedFromThis<CronosReceiptWatcher, ESPMode::ThreadSafe> {
+  public:
+    /**
+     * receipt: same format as the sdk receipt
+     * error: "" if succeed
+     */
+    typedef TFunction<void(FCronosTransactionReceiptRaw receipt,
+                           FString error)>
+        Callback;
+
+    // txhash: 0x hex, error: "" if succeed
+    typedef TFunction<void(FString txhash, FString error)> SentCallback;
+
+    explicit CronosReceiptWatcher(
+        TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher);
+
+    /**
+     * shared watcher of an endpoint, created on first use
+     */
+    static TSharedRef<CronosReceiptWatcher, ESPMode::ThreadSafe>
+    forEndpoint(const FString &rpcurl);
+
+    // seconds between polls
+    void setPollInterval(float seconds);
+
+    // seconds to wait for a receipt, then the tx is reported as dropped
+    void setTimeout(float seconds);
+
+    // poll once per block of clock instead of every poll interval, nullptr
+    // to use the poll interval, applies from the next pending tx on
+    void
+    setBlockClock(TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> clock);
+
+    /**
+     * call back once the receipt of txhash lands or the timeout expires
+     */
+    void watch(const FString &txhash, Callback callback);
+
+    /**
+     * broadcast with eth_sendRawTransaction through the broadcast queue of
+     * the endpoint
+     * sent is called as soon as the tx hash is known, mined (optional) once
+     * its receipt lands, mined is not called if sending failed
+     * returns false if the broadcast queue is full, sent gets the error
+     */
+    bool send(const TArray<uint8> &signedtx, SentCallback sent,
+              Callback mined = nullptr);
+
+    // poll every pending tx now, e.g. on a new block, game thread only
+    void poll();
+
+    int32 getPendingCount();
+
+    /**
+     * convert a json-rpc receipt, throws std::runtime_error if invalid
+     */
+    static FCronosTransactionReceiptRaw
+    toReceipt(const TSharedPtr<FJsonObject> &receipt);
+
+  private:
+    struct PendingTx {
+        TArray<Callback> callbacks;
+        double deadline;
+        bool polling;
+    };
+
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher;
+    std::mutex mutex;
+    TMap<FString, PendingTx> pending;
+    float pollinterval;
+    float timeout;
+    bool tickerscheduled;
+    TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> blockclock;
+    // clock polling is subscribed to, and its subscription
+    TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> pollclock;
+    FDelegateHandle pollhandle;
+
+    void scheduleTicker();
+    void startPolling();
+    bool onPollTick();
+    void complete(const FString &txhash, TSharedPtr<FJsonValue> result,
+                  FString error);
+};
@@ -0,0 +1,399 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosRpcBatcher.h"
+
+#include "Async/Async.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "PlayCppSdkDownloader.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+static std::mutex batchersmutex;
+static TMap<FString, TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe>>
+    batchers;
+
+// hedges that may be saved up while idle
+static const double HedgeCreditMax = 5.0;
+
+CronosRpcBatcher::CronosRpcBatcher(const FString &rpcurl)
+    : url(rpcurl), endpoints(CronosEndpointPool::forEndpoints(
+                       rpcurl, CronosEndpointPool::EProbe::JsonRpc)),
+      maxbatchsize(20), flushinterval(0.01f),
+      flushscheduled(false), nextid(1), hedgebudget(0.0f), hedgecredit(0.0) {}
+
+TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe>
+CronosRpcBatcher::forEndpoint(const FString &rpcurl) {
+    std::lock_guard<std::mutex> lock(batchersmutex);
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> *found =
+        batchers.Find(rpcurl);
+    if (found != NULL) {
+        return *found;
+    }
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher =
+        MakeShared<CronosRpcBatcher, ESPMode::ThreadSafe>(rpcurl);
+    batchers.Add(rpcurl, batcher);
+    return batcher;
+}
+
+void CronosRpcBatcher::setMaxBatchSize(int32 size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    maxbatchsize = FMath::Max(1, size);
+}
+
+void CronosRpcBatcher::setFlushInterval(float seconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    flushinterval = FMath::Max(0.0f, seconds);
+}
+
+void CronosRpcBatcher::setHedgeBudget(float budget) {
+    std::lock_guard<std::mutex> lock(mutex);
+    hedgebudget = FMath::Clamp(budget, 0.0f, 1.0f);
+}
+
+void CronosRpcBatcher::call(const FString &method, const FString &params,
+                            Callback callback) {
+    TArray<PendingCall> full;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (isReadMethod(method)) {
+            FString key = method + params;
+            TArray<Callback> *followers = flights.Find(key);
+            if (followers != NULL) {
+                followers->Add(MoveTemp(callback));
+                coalescedcount++;
+                return;
+            }
+            flights.Add(key);
+            // the first call answers the identical ones made meanwhile
+            TWeakPtr<CronosRpcBatcher, ESPMode::ThreadSafe> weakself =
+                AsShared();
+            callback = [weakself, key, leader = MoveTemp(callback)](
+                           TSharedPtr<FJsonValue> result, FString error) {
+                TArray<Callback> followers;
+                TSharedPtr<CronosRpcBatcher, ESPMode::ThreadSafe> self =
+                    weakself.Pin();
+                if (self.IsValid()) {
+                    std::lock_guard<std::mutex> lock(self->mutex);
+                    self->flights.RemoveAndCopyValue(key, followers);
+                }
+                leader(result, error);
+                for (Callback &follower : followers) {
+                    follower(result, error);
+                }
+            };
+        }
+
+        PendingCall pending;
+        pending.id = nextid++;
+        pending.method = method;
+        pending.params = params;
+        pending.callback = MoveTemp(callback);
+        queue.Add(MoveTemp(pending));
+
+        if (queue.Num() >= maxbatchsize) {
+            // batch is full, don't wait for the flush interval
+            full = MoveTemp(queue);
+            queue.Reset();
+        } else {
+            scheduleFlush();
+        }
+    }
+
+    if (full.Num() > 0) {
+        TWeakPtr<CronosRpcBatcher, ESPMode::ThreadSafe> weakself = AsShared();
+        AsyncTask(ENamedThreads::GameThread, [weakself, full]() {
+            TSharedPtr<CronosRpcBatcher, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            if (self.IsValid()) {
+                self->sendBatch(full);
+            }
+        });
+    }
+}
+
+TFuture<CronosRpcBatcher::Response>
+CronosRpcBatcher::callFuture(const FString &method, const FString &params) {
+    TSharedRef<TPromise<Response>, ESPMode::ThreadSafe> promise =
+        MakeShared<TPromise<Response>, ESPMode::ThreadSafe>();
+    TFuture<Response> future = promise->GetFuture();
+    call(method, params,
+         [promise](TSharedPtr<FJsonValue> result, FString callerror) {
+             promise->SetValue(Response(result, callerror));
+         });
+    return future;
+}
+
+TSharedPtr<FJsonValue> CronosRpcBatcher::callBlocking(const FString &method,
+                                                      const FString &params,
+                                                      FString &error,
+                                                      float timeout) {
+    if (IsInGameThread()) {
+        // the response is delivered on the game thread, would never return
+        error = TEXT("Blocking json-rpc call on the game thread");
+        return nullptr;
+    }
+
+    TFuture<Response> future = callFuture(method, params);
+    if (!future.WaitFor(FTimespan::FromSeconds(timeout))) {
+        error = TEXT("Json-rpc call timeout");
+        return nullptr;
+    }
+    Response response = future.Get();
+    error = response.Value;
+    return response.Key;
+}
+
+void CronosRpcBatcher::scheduleFlush() {
+    // caller holds mutex
+    if (flushscheduled) {
+        return;
+    }
+    flushscheduled = true;
+
+    TWeakPtr<CronosRpcBatcher, ESPMode::ThreadSafe> weakself = AsShared();
+    float delay = flushinterval;
+    AsyncTask(ENamedThreads::GameThread, [weakself, delay]() {
+        FTickerDelegate flushdelegate =
+            FTickerDelegate::CreateLambda([weakself](float deltatime) {
+                TSharedPtr<CronosRpcBatcher, ESPMode::ThreadSafe> self =
+                    weakself.Pin();
+                if (self.IsValid()) {
+                    self->flush();
+                }
+                return false; // one shot
+            });
+#if ENGINE_MAJOR_VERSION == 4
+        FTicker::GetCoreTicker().AddTicker(flushdelegate, delay);
+#else
+        FTSTicker::GetCoreTicker().AddTicker(flushdelegate, delay);
+#endif
+    });
+}
+
+void CronosRpcBatcher::flush() {
+    TArray<TArray<PendingCall>> batches;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        flushscheduled = false;
+        while (queue.Num() > 0) {
+            int32 count = FMath::Min(queue.Num(), maxbatchsize);
+            TArray<PendingCall> batch;
+            batch.Reserve(count);
+            for (int32 i = 0; i < count; i++) {
+                batch.Add(MoveTemp(queue[i]));
+            }
+            queue.RemoveAt(0, count);
+            batches.Add(MoveTemp(batch));
+        }
+    }
+
+    for (TArray<PendingCall> &batch : batches) {
+        sendBatch(MoveTemp(batch));
+    }
+}
+
+bool CronosRpcBatcher::isReadMethod(const FString &method) {
+    return method.StartsWith(TEXT("eth_get")) || method == TEXT("eth_call") ||
+           method == TEXT("eth_blockNumber") || method == TEXT("eth_chainId") ||
+           method == TEXT("eth_gasPrice") || method == TEXT("eth_feeHistory") ||
+           method == TEXT("eth_estimateGas");
+}
+
+void CronosRpcBatcher::sendBatch(TArray<PendingCall> batch) {
+    if (batch.Num() == 0) {
+        return;
+    }
+
+    TArray<FString> requests;
+    requests.Reserve(batch.Num());
+    bool reads = true;
+    for (const PendingCall &pending : batch) {
+        requests.Add(FString::Printf(
+            TEXT("{\"jsonrpc\":\"2.0\",\"id\":%lld,\"method\":\"%s\","
+                 "\"params\":%s}"),
+            pending.id, *pending.method, *pending.params));
+        reads = reads && isReadMethod(pending.method);
+    }
+
+    TSharedRef<BatchAttempts> attempts = MakeShared<BatchAttempts>();
+    // a single call is sent as a plain request, not as a batch
+    attempts->body = batch.Num() == 1
+                         ? requests[0]
+                         : TEXT("[") + FString::Join(requests, TEXT(",")) +
+                               TEXT("]");
+    attempts->calls = MoveTemp(batch);
+    FString primary = sendAttempt(attempts, FString());
+    if (reads) {
+        scheduleHedge(attempts, primary);
+    }
+}
+
+FString CronosRpcBatcher::sendAttempt(TSharedRef<BatchAttempts> attempts,
+                                      const FString &exclude) {
+    FString target = endpoints->pick(exclude);
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> httprequest =
+        FHttpModule::Get().CreateRequest();
+    httprequest->SetVerb(TEXT("POST"));
+    httprequest->SetURL(target);
+    httprequest->SetHeader(TEXT("User-Agent"),
+                           UPlayCppSdkDownloader::UserAgent);
+    httprequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    httprequest->SetContentAsString(attempts->body);
+    attempts->requests.Add(httprequest);
+    attempts->inflight++;
+
+    TWeakPtr<CronosRpcBatcher, ESPMode::ThreadSafe> weakself = AsShared();
+    double start = FPlatformTime::Seconds();
+    httprequest->OnProcessRequestComplete().BindLambda(
+        [weakself, attempts, target,
+         start](FHttpRequestPtr request, FHttpResponsePtr response,
+                bool connectedSuccessfully) {
+            if (attempts->done) {
+                // the other request answered first and cancelled this one
+                return;
+            }
+            attempts->inflight--;
+            TSharedPtr<CronosRpcBatcher, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            if (self.IsValid()) {
+                bool reached = CronosEndpointPool::isReached(
+                    response, connectedSuccessfully);
+                self->endpoints->report(
+                    target, FPlatformTime::Seconds() - start, reached);
+                if (!reached && attempts->inflight > 0) {
+                    // the hedge may still answer
+                    return;
+                }
+                // resending is safe, reads are repeatable and a raw tx is
+                // the same tx on every endpoint
+                if (!reached && !attempts->retried &&
+                    self->endpoints->getCount() > 1) {
+                    attempts->retried = true;
+                    self->sendAttempt(attempts, target);
+                    return;
+                }
+            }
+            attempts->done = true;
+            for (const FHttpRequestPtr &other : attempts->requests) {
+                if (other != request &&
+                    other->GetStatus() == EHttpRequestStatus::Processing) {
+                    other->CancelRequest();
+                }
+            }
+            // the requests hold this callback, which holds attempts
+            attempts->requests.Empty();
+            completeBatch(attempts->calls, response, connectedSuccessfully);
+        });
+    httprequest->ProcessRequest();
+    return target;
+}
+
+void CronosRpcBatcher::scheduleHedge(TSharedRef<BatchAttempts> attempts,
+                                     const FString &primary) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (hedgebudget <= 0.0f) {
+            return;
+        }
+        hedgecredit = FMath::Min(hedgecredit + hedgebudget, HedgeCreditMax);
+    }
+    if (endpoints->getCount() < 2) {
+        return;
+    }
+    // no hedge until the endpoint has a latency history
+    double delay = endpoints->getLatencyPercentile(primary, 0.95);
+    if (delay < 0.0) {
+        return;
+    }
+
+    TWeakPtr<CronosRpcBatcher, ESPMode::ThreadSafe> weakself = AsShared();
+    FTickerDelegate hedgedelegate = FTickerDelegate::CreateLambda(
+        [weakself, attempts, primary](float deltatime) {
+            TSharedPtr<CronosRpcBatcher, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            if (self.IsValid() && !attempts->done && !attempts->retried &&
+                attempts->inflight == 1 && self->takeHedgeCredit()) {
+                self->sendAttempt(attempts, primary);
+            }
+            return false; // one shot
+        });
+#if ENGINE_MAJOR_VERSION == 4
+    FTicker::GetCoreTicker().AddTicker(hedgedelegate, (float)delay);
+#else
+    FTSTicker::GetCoreTicker().AddTicker(hedgedelegate, (float)delay);
+#endif
+}
+
+bool CronosRpcBatcher::takeHedgeCredit() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (hedgecredit < 1.0) {
+        return false;
+    }
+    hedgecredit -= 1.0;
+    return true;
+}
+
+void CronosRpcBatcher::completeBatch(TArray<PendingCall> &batch,
+                                     FHttpResponsePtr httpresponse,
+                                     bool connectedSuccessfully) {
+    FString error;
+    TMap<int64, TSharedPtr<FJsonObject>> responses;
+    if (!connectedSuccessfully || !httpresponse.IsValid()) {
+        error = TEXT("Connection failed.");
+    } else if (httpresponse->GetResponseCode() != 200) {
+        error = FString::Printf(TEXT("Http error %d"),
+                                httpresponse->GetResponseCode());
+    } else {
+        TSharedRef<TJsonReader<TCHAR>> jsonreader =
+            TJsonReaderFactory<TCHAR>::Create(
+                httpresponse->GetContentAsString());
+        TSharedPtr<FJsonValue> jsonvalue;
+        if (!FJsonSerializer::Deserialize(jsonreader, jsonvalue) ||
+            !jsonvalue.IsValid()) {
+            error = TEXT("Failed to parse json-rpc response");
+        } else {
+            TArray<TSharedPtr<FJsonValue>> items;
+            if (jsonvalue->Type == EJson::Array) {
+                items = jsonvalue->AsArray();
+            } else {
+                items.Add(jsonvalue);
+            }
+            for (const TSharedPtr<FJsonValue> &item : items) {
+                const TSharedPtr<FJsonObject> *object = NULL;
+                int64 id = 0;
+                if (item->TryGetObject(object) &&
+                    (*object)->TryGetNumberField(TEXT("id"), id)) {
+                    responses.Add(id, *object);
+                }
+            }
+        }
+    }
+
+    for (PendingCall &pending : batch) {
+        TSharedPtr<FJsonValue> result = MakeShared<FJsonValueNull>();
+        FString callerror = error;
+        if (callerror.IsEmpty()) {
+            TSharedPtr<FJsonObject> *response = responses.Find(pending.id);
+            if (response == NULL) {
+                callerror = TEXT("Missing json-rpc response");
+            } else if ((*response)->HasField(TEXT("error"))) {
+                const TSharedPtr<FJsonObject> *errorobject = NULL;
+                FString message;
+                if ((*response)->TryGetObjectField(TEXT("error"),
+                                                   errorobject) &&
+                    (*errorobject)->TryGetStringField(TEXT("message"),
+                                                      message)) {
+                    callerror = message;
+                } else {
+                    callerror = TEXT("Unknown json-rpc error");
+                }
+            } else if ((*response)->HasField(TEXT("result"))) {
+                result = (*response)->TryGetField(TEXT("result"));
+            }
+        }
+        pending.callback(result, callerror);
+    }
+}
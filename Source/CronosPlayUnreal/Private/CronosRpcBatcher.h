@@ -0,0 +1,148 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "CronosEndpointPool.h"
+#include "Dom/JsonValue.h"
+#include "Interfaces/IHttpRequest.h"
+#include <atomic>
+#include <mutex>
+
+/**
+ * json-rpc batch aggregator for one cronos evm endpoint
+ * calls issued within the flush interval (or until the batch is full) are sent
+ * as one json-rpc batch array, responses are matched back by id
+ * the endpoint may be a comma separated list, each batch goes to the fastest
+ * healthy endpoint and once more to another one if it isn't reached
+ * identical concurrent reads (same method and params) share one call
+ * with a hedge budget, a batch of reads still unanswered after the p95
+ * latency of its endpoint is sent to a second endpoint too, the first answer
+ * wins and the other request is cancelled
+ * call() is thread-safe, callbacks run on the game thread
+ */
+class CronosRpcBatcher
+    : public TSharedFromThis<CronosRpcBatcher, ESPMode::ThreadSafe> {
+  public:
+    /**
+     * result: the "result" member of the response (json null if missing)
+     * error: "" if succeed
+     */
+    typedef TFunction<void(TSharedPtr<FJsonValue> result, FString error)>
+        Callback;
+
+    // result and error of a call, as passed to Callback
+    typedef TPair<TSharedPtr<FJsonValue>, FString> Response;
+
+    explicit CronosRpcBatcher(const FString &rpcurl);
+
+    /**
+     * shared batcher of an endpoint, created on first use
+     */
+    static TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe>
+    forEndpoint(const FString &rpcurl);
+
+    // the endpoint (list) of the batcher
+    const FString &getUrl() const { return url; }
+
+    // health of the endpoints of the list
+    TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe> getEndpoints() const {
+        return endpoints;
+    }
+
+    // max calls in one batch, 1 disables batching
+    void setMaxBatchSize(int32 size);
+
+    // seconds to wait for more calls, 0 flushes on the next frame
+    void setFlushInterval(float seconds);
+
+    // max extra batches sent as hedges, as a fraction of the batches sent
+    // (e.g. 0.05), 0 disables hedging
+    void setHedgeBudget(float budget);
+
+    /**
+     * queue a json-rpc call, a read identical to one queued or in flight is
+     * not sent again but gets the result of that one
+     * @param method json-rpc method, e.g. eth_call
+     * @param params json array of parameters, e.g. ["0x..", "latest"]
+     * @param callback called once with result or error
+     */
+    void call(const FString &method, const FString &params, Callback callback);
+
+    /**
+     * queue a json-rpc call, the future is set on the game thread, so only
+     * worker threads may wait for it
+     */
+    TFuture<Response> callFuture(const FString &method, const FString &params);
+
+    /**
+     * queue a json-rpc call and wait for its result, worker threads only
+     * (the response is delivered on the game thread)
+     * @param error "" if succeed
+     */
+    TSharedPtr<FJsonValue> callBlocking(const FString &method,
+                                        const FString &params, FString &error,
+                                        float timeout = 30.0f);
+
+    // send all queued calls now, game thread only
+    void flush();
+
+    // how many reads got the result of an identical call
+    uint64 getCoalescedCount() const { return coalescedcount; }
+
+  private:
+    struct PendingCall {
+        int64 id;
+        FString method;
+        FString params;
+        Callback callback;
+    };
+
+    // requests of one batch, up to two in flight, game thread only
+    struct BatchAttempts {
+        TArray<PendingCall> calls;
+        FString body;
+        TArray<FHttpRequestPtr> requests;
+        int32 inflight = 0;
+        bool retried = false;
+        bool done = false;
+    };
+
+    FString url;
+    TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe> endpoints;
+    std::mutex mutex;
+    TArray<PendingCall> queue;
+    int32 maxbatchsize;
+    float flushinterval;
+    bool flushscheduled;
+    int64 nextid;
+    // method and params of reads queued or in flight -> callbacks of the
+    // identical reads waiting for them
+    TMap<FString, TArray<Callback>> flights;
+    std::atomic<uint64> coalescedcount{0};
+    float hedgebudget;
+    // hedges that may be sent now, each batch of reads earns hedgebudget
+    double hedgecredit;
+
+    void scheduleFlush();
+    void sendBatch(TArray<PendingCall> batch);
+
+    /**
+     * send the batch to the fastest healthy endpoint other than exclude
+     * @return the endpoint
+     */
+    FString sendAttempt(TSharedRef<BatchAttempts> attempts,
+                        const FString &exclude);
+
+    void scheduleHedge(TSharedRef<BatchAttempts> attempts,
+                       const FString &primary);
+
+    // whether a hedge may be sent, and take it from the budget
+    bool takeHedgeCredit();
+
+    // whether repeating the call is harmless and answers the same
+    static bool isReadMethod(const FString &method);
+    static void completeBatch(TArray<PendingCall> &batch,
+                              FHttpResponsePtr httpresponse,
+                              bool connectedSuccessfully);
+};
@@ -0,0 +1,300 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosTokenEnumerator.h"
+
+#include <stdexcept>
+
+#include "CronosAbi.h"
+#include "CronosMulticall.h"
+
+// tries of a page before the enumeration fails
+static const int32 EnumerationPageAttempts = 3;
+
+static FString enumerationCall(const FString &to, const FString &data) {
+    return FString::Printf(
+        TEXT("[{\"to\":\"%s\",\"data\":\"0x%s\"},\"latest\"]"), *to, *data);
+}
+
+CronosTokenEnumerator::CronosTokenEnumerator(
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher,
+    const FString &contract, const FString &owner, const FString &multicall)
+    : batcher(rpcbatcher),
+      contractaddress(CronosAbi::normalizeAddress(contract)),
+      owneraddress(CronosAbi::normalizeAddress(owner)),
+      multicalladdress(multicall.IsEmpty()
+                           ? FString()
+                           : CronosAbi::normalizeAddress(multicall)),
+      pagesize(100), concurrency(4), total(0), next(0), inflight(0),
+      checks(0), finished(false) {}
+
+void CronosTokenEnumerator::setPageSize(int32 size) {
+    pagesize = FMath::Max(1, size);
+}
+
+void CronosTokenEnumerator::setConcurrency(int32 pages) {
+    concurrency = FMath::Max(1, pages);
+}
+
+FString CronosTokenEnumerator::encodeIndex(int64 index) const {
+    return CronosAbi::TokenOfOwnerByIndex +
+           CronosAbi::encodeAddress(owneraddress) +
+           CronosAbi::encodeSize(index);
+}
+
+void CronosTokenEnumerator::start(PageCallback onpage, DoneCallback ondone) {
+    pagecallback = onpage;
+    donecallback = ondone;
+    checks = 2;
+    TWeakPtr<CronosTokenEnumerator, ESPMode::ThreadSafe> weakself =
+        AsShared();
+    // both go out in one json-rpc batch
+    batcher->call(
+        TEXT("eth_call"),
+        enumerationCall(contractaddress,
+                        CronosAbi::BalanceOf +
+                            CronosAbi::encodeAddress(owneraddress)),
+        [weakself](TSharedPtr<FJsonValue> result, FString error) {
+            TSharedPtr<CronosTokenEnumerator, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            if (self.IsValid()) {
+                self->onBalance(result, error);
+            }
+        });
+    // the bytes4 argument is left aligned in its word
+    batcher->call(
+        TEXT("eth_call"),
+        enumerationCall(contractaddress,
+                        CronosAbi::SupportsInterface +
+                            FString(CronosAbi::Erc721EnumerableId) +
+                            FString::ChrN(56, TCHAR('0'))),
+        [weakself](TSharedPtr<FJsonValue> result, FString error) {
+            TSharedPtr<CronosTokenEnumerator, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            if (self.IsValid()) {
+                self->onInterface(result, error);
+            }
+        });
+}
+
+void CronosTokenEnumerator::cancel() {
+    finished = true;
+    pagecallback = nullptr;
+    donecallback = nullptr;
+}
+
+void CronosTokenEnumerator::onBalance(TSharedPtr<FJsonValue> result,
+                                      const FString &error) {
+    if (finished) {
+        return;
+    }
+    FString balanceerror = error;
+    FString data;
+    if (balanceerror.IsEmpty() && !result->TryGetString(data)) {
+        balanceerror = TEXT("Invalid json-rpc result");
+    }
+    if (balanceerror.IsEmpty()) {
+        try {
+            FString balance = CronosAbi::decodeUint256(data);
+            if (balance.Len() > 18) {
+                throw std::runtime_error("Balance too large");
+            }
+            total = FCString::Atoi64(*balance);
+        } catch (const std::exception &e) {
+            balanceerror = UTF8_TO_TCHAR(e.what());
+        }
+    }
+    if (!balanceerror.IsEmpty()) {
+        finish(balanceerror);
+        return;
+    }
+    if (--checks == 0) {
+        pump();
+    }
+}
+
+void CronosTokenEnumerator::onInterface(TSharedPtr<FJsonValue> result,
+                                        const FString &error) {
+    if (finished) {
+        return;
+    }
+    if (!error.IsEmpty() && !error.Contains(TEXT("revert"))) {
+        finish(error);
+        return;
+    }
+    // a revert or an empty answer means no erc-165 either
+    bool enumerable = false;
+    FString data;
+    if (error.IsEmpty() && result->TryGetString(data)) {
+        try {
+            enumerable = CronosAbi::decodeBool(data);
+        } catch (const std::exception &) {
+            enumerable = false;
+        }
+    }
+    if (!enumerable) {
+        // every tokenOfOwnerByIndex would revert into empty pages
+        finish(TEXT("Contract is not ERC721Enumerable"));
+        return;
+    }
+    if (--checks == 0) {
+        pump();
+    }
+}
+
+void CronosTokenEnumerator::pump() {
+    while (!finished && inflight < concurrency && next < total) {
+        int32 count = (int32)FMath::Min((int64)pagesize, total - next);
+        int64 start = next;
+        next += count;
+        inflight++;
+        fetchPage(start, count, 1);
+    }
+    if (!finished && inflight == 0 && next >= total) {
+        finish(FString());
+    }
+}
+
+void CronosTokenEnumerator::fetchPage(int64 start, int32 count,
+                                      int32 attempt) {
+    if (multicalladdress.IsEmpty()) {
+        fetchPageSingle(start, count, attempt);
+    } else {
+        fetchPageMulticall(start, count, attempt);
+    }
+}
+
+void CronosTokenEnumerator::fetchPageMulticall(int64 start, int32 count,
+                                               int32 attempt) {
+    TArray<FCronosMulticallItem> items;
+    items.SetNum(count);
+    for (int32 i = 0; i < count; i++) {
+        items[i].ContractAddress = contractaddress;
+        items[i].Function = ECronosMulticallFunction::Raw;
+        items[i].CallData = encodeIndex(start + i);
+    }
+    TWeakPtr<CronosTokenEnumerator, ESPMode::ThreadSafe> weakself =
+        AsShared();
+    batcher->call(
+        TEXT("eth_call"),
+        enumerationCall(multicalladdress,
+                        CronosMulticall::encodeAggregate3(items)),
+        [weakself, items, start, count,
+         attempt](TSharedPtr<FJsonValue> result, FString error) {
+            TSharedPtr<CronosTokenEnumerator, ESPMode::ThreadSafe> self =
+                weakself.Pin();
+            if (!self.IsValid() || self->finished) {
+                return;
+            }
+            TArray<FString> tokens;
+            FString data;
+            if (error.IsEmpty() && !result->TryGetString(data)) {
+                error = TEXT("Invalid json-rpc result");
+            }
+            if (error.IsEmpty()) {
+                try {
+                    TArray<FCronosMulticallResult> results =
+                        CronosMulticall::decodeAggregate3(data, items);
+                    tokens.SetNum(count);
+                    for (int32 i = 0; i < count; i++) {
+                        if (results[i].Success) {
+                            tokens[i] = CronosAbi::decodeUint256(
+                                results[i].ReturnData);
+                        }
+                    }
+                } catch (const std::exception &e) {
+                    error = UTF8_TO_TCHAR(e.what());
+                }
+            }
+            if (!error.IsEmpty()) {
+                // e.g. no Multicall3 on this chain, the page is fetched
+                // again with one eth_call per index
+                self->multicalladdress.Empty();
+                self->fetchPageSingle(start, count, attempt);
+                return;
+            }
+            self->onPage(start, count, attempt, tokens, error);
+        });
+}
+
+void CronosTokenEnumerator::fetchPageSingle(int64 start, int32 count,
+                                            int32 attempt) {
+    struct PageState {
+        TArray<FString> tokens;
+        int32 pending = 0;
+        FString error;
+    };
+    TSharedRef<PageState> state = MakeShared<PageState>();
+    state->tokens.SetNum(count);
+    state->pending = count;
+    TWeakPtr<CronosTokenEnumerator, ESPMode::ThreadSafe> weakself =
+        AsShared();
+    // the batcher sends the calls of a page as json-rpc batches
+    for (int32 i = 0; i < count; i++) {
+        batcher->call(
+            TEXT("eth_call"),
+            enumerationCall(contractaddress, encodeIndex(start + i)),
+            [weakself, state, i, start, count,
+             attempt](TSharedPtr<FJsonValue> result, FString error) {
+                FString data;
+                if (error.IsEmpty() && result->TryGetString(data)) {
+                    try {
+                        state->tokens[i] = CronosAbi::decodeUint256(data);
+                    } catch (const std::exception &e) {
+                        state->error = UTF8_TO_TCHAR(e.what());
+                    }
+                } else if (error.IsEmpty()) {
+                    state->error = TEXT("Invalid json-rpc result");
+                } else if (!error.Contains(TEXT("revert"))) {
+                    state->error = error;
+                }
+                if (--state->pending > 0) {
+                    return;
+                }
+                TSharedPtr<CronosTokenEnumerator, ESPMode::ThreadSafe> self =
+                    weakself.Pin();
+                if (self.IsValid() && !self->finished) {
+                    self->onPage(start, count, attempt, state->tokens,
+                                 state->error);
+                }
+            });
+    }
+}
+
+void CronosTokenEnumerator::onPage(int64 start, int32 count, int32 attempt,
+                                   const TArray<FString> &tokens,
+                                   const FString &error) {
+    if (!error.IsEmpty()) {
+        if (attempt < EnumerationPageAttempts) {
+            fetchPage(start, count, attempt + 1);
+        } else {
+            finish(error);
+        }
+        return;
+    }
+    inflight--;
+    TArray<FString> tokenids;
+    for (const FString &token : tokens) {
+        if (!token.IsEmpty()) {
+            tokenids.Add(token);
+        }
+    }
+    // the callback may cancel the enumeration
+    PageCallback onpage = pagecallback;
+    if (onpage) {
+        onpage(start, tokenids);
+    }
+    pump();
+}
+
+void CronosTokenEnumerator::finish(const FString &error) {
+    if (finished) {
+        return;
+    }
+    finished = true;
+    DoneCallback ondone = donecallback;
+    pagecallback = nullptr;
+    donecallback = nullptr;
+    if (ondone) {
+        ondone(total, error);
+    }
+}
@@ -0,0 +1,89 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "CronosRpcBatcher.h"
+
+/**
+ * token ids of an owner of an enumerable erc-721 contract: balanceOf and
+ * supportsInterface of ERC721Enumerable, then
+ * tokenOfOwnerByIndex of every index, a page of indexes per Multicall3
+ * eth_call (or per batch of eth_calls if the Multicall3 call fails), with a
+ * bounded number of pages in flight
+ * pages are delivered as they complete, not necessarily in index order
+ * game thread only, callbacks run on the game thread
+ */
+class CronosTokenEnumerator
+    : public TSharedFromThis<CronosTokenEnumerator, ESPMode::ThreadSafe> {
+  public:
+    /**
+     * token ids at [start, start + count) of the owner's tokens, indexes
+     * that revert (tokens sent away meanwhile) are left out
+     */
+    typedef TFunction<void(int64 start, const TArray<FString> &tokenids)>
+        PageCallback;
+
+    /**
+     * called once after the last page, not after cancel()
+     * total: balance of the owner, error: "" if every page was delivered,
+     * set without any page if the contract is not ERC721Enumerable
+     */
+    typedef TFunction<void(int64 total, const FString &error)> DoneCallback;
+
+    /**
+     * throws if contract or owner is not an address
+     * @param multicall Multicall3 address, "" to send one eth_call per index
+     */
+    CronosTokenEnumerator(
+        TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> rpcbatcher,
+        const FString &contract, const FString &owner,
+        const FString &multicall);
+
+    // indexes per page
+    void setPageSize(int32 size);
+
+    // max pages in flight
+    void setConcurrency(int32 pages);
+
+    // query the balance and the interface, then start fetching pages
+    void start(PageCallback onpage, DoneCallback ondone);
+
+    // fetch no more pages and drop the answers of those in flight
+    void cancel();
+
+  private:
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher;
+    FString contractaddress;
+    FString owneraddress;
+    FString multicalladdress;
+    int32 pagesize;
+    int32 concurrency;
+    PageCallback pagecallback;
+    DoneCallback donecallback;
+    int64 total;
+    // first index without a page yet
+    int64 next;
+    int32 inflight;
+    // answers of balanceOf and supportsInterface still missing
+    int32 checks;
+    bool finished;
+
+    void onBalance(TSharedPtr<FJsonValue> result, const FString &error);
+    void onInterface(TSharedPtr<FJsonValue> result, const FString &error);
+
+    // start pages until concurrency is reached, finish after the last one
+    void pump();
+
+    void fetchPage(int64 start, int32 count, int32 attempt);
+    void fetchPageMulticall(int64 start, int32 count, int32 attempt);
+    void fetchPageSingle(int64 start, int32 count, int32 attempt);
+
+    // tokens has an entry per index, "" for the reverted ones
+    void onPage(int64 start, int32 count, int32 attempt,
+                const TArray<FString> &tokens, const FString &error);
+
+    void finish(const FString &error);
+
+    // calldata of tokenOfOwnerByIndex(owner, index)
+    FString encodeIndex(int64 index) const;
+};
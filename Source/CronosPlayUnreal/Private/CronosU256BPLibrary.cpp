@@ -0,0 +1,117 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "CronosU256BPLibrary.h"
+
+FCronosU256 UCronosU256BPLibrary::U256FromString(FString Value,
+                                                 bool &Success) {
+    FCronosU256 ret;
+    Success = FCronosU256::parse(Value, ret);
+    return ret;
+}
+
+FCronosU256 UCronosU256BPLibrary::U256FromInt64(int64 Value) {
+    return FCronosU256(Value > 0 ? (uint64)Value : 0);
+}
+
+FString UCronosU256BPLibrary::U256ToString(FCronosU256 Value) {
+    return Value.toString();
+}
+
+FString UCronosU256BPLibrary::U256ToHex(FCronosU256 Value) {
+    return Value.toHex();
+}
+
+int64 UCronosU256BPLibrary::U256ToInt64(FCronosU256 Value, bool &Success) {
+    Success = Value <= FCronosU256((uint64)MAX_int64);
+    return Success ? (int64)Value.Limbs[0] : MAX_int64;
+}
+
+FCronosU256 UCronosU256BPLibrary::ParseUnits(FString Amount, int32 Decimals,
+                                             bool &Success) {
+    FCronosU256 ret;
+    Success = FCronosU256::parseUnits(Amount, Decimals, ret);
+    return ret;
+}
+
+FString UCronosU256BPLibrary::FormatUnits(FCronosU256 Value, int32 Decimals) {
+    return Value.formatUnits(Decimals);
+}
+
+FCronosU256 UCronosU256BPLibrary::Add_U256U256(FCronosU256 A, FCronosU256 B) {
+    return FCronosU256::saturatingAdd(A, B);
+}
+
+FCronosU256 UCronosU256BPLibrary::Subtract_U256U256(FCronosU256 A,
+                                                    FCronosU256 B) {
+    return FCronosU256::saturatingSub(A, B);
+}
+
+FCronosU256 UCronosU256BPLibrary::Multiply_U256U256(FCronosU256 A,
+                                                    FCronosU256 B) {
+    return FCronosU256::saturatingMul(A, B);
+}
+
+FCronosU256 UCronosU256BPLibrary::Divide_U256U256(FCronosU256 A,
+                                                  FCronosU256 B) {
+    return A / B;
+}
+
+FCronosU256 UCronosU256BPLibrary::Percent_U256U256(FCronosU256 A,
+                                                   FCronosU256 B) {
+    return A % B;
+}
+
+FCronosU256 UCronosU256BPLibrary::CheckedAdd(FCronosU256 A, FCronosU256 B,
+                                             bool &Success) {
+    FCronosU256 ret;
+    Success = FCronosU256::checkedAdd(A, B, ret);
+    return Success ? ret : FCronosU256();
+}
+
+FCronosU256 UCronosU256BPLibrary::CheckedSubtract(FCronosU256 A,
+                                                  FCronosU256 B,
+                                                  bool &Success) {
+    FCronosU256 ret;
+    Success = FCronosU256::checkedSub(A, B, ret);
+    return Success ? ret : FCronosU256();
+}
+
+FCronosU256 UCronosU256BPLibrary::CheckedMultiply(FCronosU256 A,
+                                                  FCronosU256 B,
+                                                  bool &Success) {
+    FCronosU256 ret;
+    Success = FCronosU256::checkedMul(A, B, ret);
+    return Success ? ret : FCronosU256();
+}
+
+FCronosU256 UCronosU256BPLibrary::CheckedDivide(FCronosU256 A, FCronosU256 B,
+                                                bool &Success) {
+    FCronosU256 ret;
+    Success = FCronosU256::checkedDiv(A, B, ret);
+    return ret;
+}
+
+bool UCronosU256BPLibrary::EqualEqual_U256U256(FCronosU256 A, FCronosU256 B) {
+    return A == B;
+}
+
+bool UCronosU256BPLibrary::NotEqual_U256U256(FCronosU256 A, FCronosU256 B) {
+    return A != B;
+}
+
+bool UCronosU256BPLibrary::Less_U256U256(FCronosU256 A, FCronosU256 B) {
+    return A < B;
+}
+
+bool UCronosU256BPLibrary::LessEqual_U256U256(FCronosU256 A, FCronosU256 B) {
+    return A <= B;
+}
+
+bool UCronosU256BPLibrary::Greater_U256U256(FCronosU256 A, FCronosU256 B) {
+    return A > B;
+}
+
+bool UCronosU256BPLibrary::GreaterEqual_U256U256(FCronosU256 A,
+                                                 FCronosU256 B) {
+    return A >= B;
+}
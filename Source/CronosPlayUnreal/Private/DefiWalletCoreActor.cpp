@@ -7,13 +7,38 @@
 
 #include "Json.h"
 
+#include "Async/ParallelFor.h"
+#include "Containers/Ticker.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
 #include "Interfaces/IPluginManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
 #include "PlayCppSdkBPLibrary.h"
 #include "PlayCppSdkLibrary/Include/defi-wallet-core-cpp/src/lib.rs.h"
 #include "PlayCppSdkLibrary/Include/rust/cxx.h"
+#include "AddressCache.h"
+#include "AsyncQuery.h"
+#include "CosmosAccountCache.h"
+#include "CosmosSendPipeline.h"
+#include "CronosAbi.h"
+#include "CronosBlockClock.h"
+#include "CronosBroadcastQueue.h"
+#include "CronosEndpointPool.h"
+#include "CronosErc1155Batch.h"
+#include "CronosGasEstimator.h"
+#include "CronosGasOracle.h"
+#include "CronosMulticall.h"
+#include "CronosNftIndexer.h"
+#include "CronosReceiptWatcher.h"
+#include "CronosRpcBatcher.h"
+#include "CronosTokenEnumerator.h"
+#include "GrpcClientPool.h"
+#include "NonceManager.h"
+#include "PrivateKeyCache.h"
+#include "ReadCache.h"
+#include "SingleFlight.h"
 #include "TxBuilder.h"
 
 #define SECURE_STORAGE_CLASS "com/cronos/play/SecureStorage"
@@ -51,11 +76,106 @@ auto convertToken(::org::defi_wallet_core::BaseNft src) -> FCosmosNFTToken {
     return ret;
 }
 
+// single-flight key of a query, identical queries of one endpoint share it
+static auto flightKey(const char *query, const FString &endpoint,
+                      const FString &param1,
+                      const FString &param2 = FString()) -> std::string {
+    return std::string(query) + "|" + TCHAR_TO_UTF8(*endpoint) + "|" +
+           TCHAR_TO_UTF8(*param1) + "|" + TCHAR_TO_UTF8(*param2);
+}
+
+/**
+ * json-rpc call through the batcher, decode runs on the game thread and may
+ * throw, errors are reported as "CronosPlayUnreal <name> Error: ..."
+ */
+template <typename OutputType, typename DelegateType>
+static void rpcCallBatched(
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher,
+    const FString &name, const FString &method, const FString &params,
+    TFunction<OutputType(const FString &)> decode, DelegateType Out) {
+    batcher->call(
+        method, params,
+        [name, decode, Out](TSharedPtr<FJsonValue> result, FString error) {
+            OutputType output{};
+            FString data;
+            if (error.IsEmpty() && !result->TryGetString(data)) {
+                error = TEXT("Invalid json-rpc result");
+            }
+            if (error.IsEmpty()) {
+                try {
+                    output = decode(data);
+                } catch (const std::exception &e) {
+                    output = OutputType{};
+                    error = UTF8_TO_TCHAR(e.what());
+                }
+            }
+            if (!error.IsEmpty()) {
+                error = FString::Printf(
+                    TEXT("CronosPlayUnreal %s Error: %s"), *name,
+                    *error);
+            }
+            Out.ExecuteIfBound(output, error);
+        });
+}
+
+/**
+ * deliver the cached answer of key on the game thread, if any
+ */
+template <typename DelegateType>
+static bool deliverCached(ReadCache &cache, const FString &key,
+                          DelegateType Out) {
+    FString value;
+    if (!cache.get(key, value)) {
+        return false;
+    }
+    AsyncTask(ENamedThreads::GameThread,
+              [Out, value]() { Out.ExecuteIfBound(value, TEXT("")); });
+    return true;
+}
+
+/**
+ * eth_call of contractAddress with the calldata (hex without 0x) returned by
+ * encode, at the latest block
+ */
+template <typename OutputType, typename DelegateType>
+static void ethCallBatched(
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher,
+    const FString &name, const FString &contractAddress,
+    TFunction<FString()> encode,
+    TFunction<OutputType(const FString &)> decode, DelegateType Out) {
+    FString params;
+    try {
+        params = FString::Printf(
+            TEXT("[{\"to\":\"%s\",\"data\":\"0x%s\"},\"latest\"]"),
+            *CronosAbi::normalizeAddress(contractAddress), *encode());
+    } catch (const std::exception &e) {
+        FString output_message =
+            FString::Printf(TEXT("CronosPlayUnreal %s Error: %s"), *name,
+                            UTF8_TO_TCHAR(e.what()));
+        AsyncTask(ENamedThreads::GameThread, [Out, output_message]() {
+            Out.ExecuteIfBound(OutputType{}, output_message);
+        });
+        return;
+    }
+    rpcCallBatched<OutputType>(batcher, name, TEXT("eth_call"), params,
+                               decode, Out);
+}
+
 // Sets default values
 ADefiWalletCoreActor::ADefiWalletCoreActor()
     : myGrpc("http://mynode:1316"), myCosmosRpc("http://mynode:1317"),
       myTendermintRpc("http://mynode:26657"), myChainID("testnet-baseball-1"),
-      myCronosRpc("http://mynode:8545"), myCronosChainID(777)
+      myCronosRpc("http://mynode:8545"), myCronosChainID(777),
+      myRpcBatchSize(20), myRpcBatchInterval(0.01f), myRpcHedgeBudget(0.0f),
+      myReceiptPollInterval(1.0f), myReceiptTimeout(120.0f),
+      myBroadcastMaxInFlight(4), myBroadcastRateLimit(10.0f),
+      myBroadcastMaxQueued(1000),
+      myBlockPollInterval(5.0f), myGasPriceTtl(5.0f), myReadCacheTtl(5.0f),
+      myGasLimitMargin(0.2f), myPrivateKeyIdleTimeout(300.0f),
+      myPersistAddressCache(true), myCosmosSendWindow(8),
+      myCosmosBroadcastAsync(false), myNftIndexChunkBlocks(2000),
+      myEnumerationPageSize(100), myEnumerationConcurrency(4),
+      myErc1155BatchChunkSize(200)
 
 {
     // Set this actor to call Tick() every frame.  You can turn this off to
@@ -63,6 +183,15 @@ ADefiWalletCoreActor::ADefiWalletCoreActor()
     PrimaryActorTick.bCanEverTick = false;
 
     _coreWallet = NULL;
+    _lastEnumeration = 0;
+    _grpcClientPool = MakeShared<GrpcClientPool, ESPMode::ThreadSafe>();
+    _singleFlight = MakeShared<SingleFlight, ESPMode::ThreadSafe>();
+    _readCache = MakeShared<ReadCache, ESPMode::ThreadSafe>();
+    _nonceManager = MakeShared<NonceManager, ESPMode::ThreadSafe>();
+    _privateKeyCache = MakeShared<PrivateKeyCache, ESPMode::ThreadSafe>();
+    _addressCache = MakeShared<AddressCache, ESPMode::ThreadSafe>();
+    _cosmosAccountCache =
+        MakeShared<CosmosAccountCache, ESPMode::ThreadSafe>();
 
     IPluginManager &PluginManager = IPluginManager::Get();
     TSharedPtr<IPlugin> Plugin = PluginManager.FindPlugin("CronosPlayUnreal");
@@ -75,7 +204,31 @@ ADefiWalletCoreActor::ADefiWalletCoreActor()
 }
 
 // Called when the game starts or when spawned
-void ADefiWalletCoreActor::BeginPlay() { Super::BeginPlay(); }
+void ADefiWalletCoreActor::BeginPlay() {
+    Super::BeginPlay();
+
+    // evicts idle private keys, also when no more txs are signed
+    TWeakObjectPtr<ADefiWalletCoreActor> weakself = this;
+    FTickerDelegate keydelegate =
+        FTickerDelegate::CreateLambda([weakself](float deltatime) {
+            if (!weakself.IsValid()) {
+                return false;
+            }
+            weakself->evictIdlePrivateKeys();
+            return true;
+        });
+#if ENGINE_MAJOR_VERSION == 4
+    FTicker::GetCoreTicker().AddTicker(keydelegate, 1.0f);
+#else
+    FTSTicker::GetCoreTicker().AddTicker(keydelegate, 1.0f);
+#endif
+}
+
+void ADefiWalletCoreActor::evictIdlePrivateKeys() {
+    _privateKeyCache->setIdleTimeout(std::chrono::milliseconds(
+        (int64)(FMath::Max(0.0f, myPrivateKeyIdleTimeout) * 1000.0f)));
+    _privateKeyCache->evictIdle();
+}
 
 // Called every frame
 void ADefiWalletCoreActor::Tick(float DeltaTime) { Super::Tick(DeltaTime); }
@@ -84,6 +237,16 @@ void ADefiWalletCoreActor::Destroyed() {
     Super::Destroyed();
 
     DestroyWallet();
+    StopBlockClock();
+    StopNftIndexer();
+    for (const auto &enumeration : _enumerations) {
+        enumeration.Value->cancel();
+    }
+    _enumerations.Empty();
+    _grpcClientPool->clear();
+    _nonceManager->clear();
+    _privateKeyCache->clear();
+    _cosmosAccountCache->clear();
 
     assert(NULL == _coreWallet);
 }
@@ -94,12 +257,17 @@ void ADefiWalletCoreActor::GetNFTSupply(FString denomid, FString nftowner,
 
 {
     try {
-        std::string mygrpcstring = TCHAR_TO_UTF8(*myGrpc);
-        rust::cxxbridge1::Box<GrpcClient> grpc_client =
-            new_grpc_client(mygrpcstring);
-
-        output = (int64)grpc_client->supply(TCHAR_TO_UTF8(*denomid),
-                                            TCHAR_TO_UTF8(*nftowner));
+        output = _singleFlight->run<int64>(
+            flightKey("nft_supply", myGrpc, denomid, nftowner), [&]() {
+                CronosEndpointCall grpc = callGrpc();
+                std::string mygrpcstring = TCHAR_TO_UTF8(*grpc.url);
+                GrpcClientPool::Lease grpc_client =
+                    _grpcClientPool->acquire(mygrpcstring);
+                return grpc.run([&]() {
+                    return (int64)grpc_client->supply(
+                        TCHAR_TO_UTF8(*denomid), TCHAR_TO_UTF8(*nftowner));
+                });
+            });
 
         success = true;
     } catch (const std::exception &e) {
@@ -109,18 +277,29 @@ void ADefiWalletCoreActor::GetNFTSupply(FString denomid, FString nftowner,
                             UTF8_TO_TCHAR(e.what()));
     }
 }
+
+void ADefiWalletCoreActor::GetNFTSupplyAsync(FString denomid, FString nftowner,
+                                             FWalletQueryInt64Delegate Out) {
+    runQueryAsync<int64>(
+        Out, [=](int64 &output, bool &success, FString &output_message) {
+            GetNFTSupply(denomid, nftowner, output, success, output_message);
+        });
+}
+
 void ADefiWalletCoreActor::GetNFTOwner(FString denomid, FString nftowner,
                                        FCosmosNFTOwner &output, bool &success,
                                        FString &output_message) {
     try {
-        std::string mygrpcstring = TCHAR_TO_UTF8(*myGrpc);
-        rust::cxxbridge1::Box<GrpcClient> grpc_client =
-            new_grpc_client(mygrpcstring);
-        new_grpc_client(mygrpcstring);
+        CronosEndpointCall grpc = callGrpc();
+        std::string mygrpcstring = TCHAR_TO_UTF8(*grpc.url);
+        GrpcClientPool::Lease grpc_client =
+            _grpcClientPool->acquire(mygrpcstring);
         ::org::defi_wallet_core::Pagination defaultpagination;
-        ::org::defi_wallet_core::Owner owner =
-            grpc_client->owner(TCHAR_TO_UTF8(*denomid),
-                               TCHAR_TO_UTF8(*nftowner), defaultpagination);
+        ::org::defi_wallet_core::Owner owner = grpc.run([&]() {
+            return grpc_client->owner(TCHAR_TO_UTF8(*denomid),
+                                      TCHAR_TO_UTF8(*nftowner),
+                                      defaultpagination);
+        });
 
         output.Address = UTF8_TO_TCHAR(owner.address.c_str());
         output.IDCollections.Empty();
@@ -149,18 +328,29 @@ void ADefiWalletCoreActor::GetNFTOwner(FString denomid, FString nftowner,
     }
 }
 
+void ADefiWalletCoreActor::GetNFTOwnerAsync(FString denomid, FString nftowner,
+                                            FCosmosNFTOwnerDelegate Out) {
+    runQueryAsync<FCosmosNFTOwner>(
+        Out, [=](FCosmosNFTOwner &output, bool &success,
+                 FString &output_message) {
+            GetNFTOwner(denomid, nftowner, output, success, output_message);
+        });
+}
+
 void ADefiWalletCoreActor::GetNFTCollection(FString denomid,
                                             FCosmosNFTCollection &output,
                                             bool &success,
                                             FString &output_message) {
     try {
-        std::string mygrpcstring = TCHAR_TO_UTF8(*myGrpc);
-        rust::cxxbridge1::Box<GrpcClient> grpc_client =
-            new_grpc_client(mygrpcstring);
-        new_grpc_client(mygrpcstring);
+        CronosEndpointCall grpc = callGrpc();
+        std::string mygrpcstring = TCHAR_TO_UTF8(*grpc.url);
+        GrpcClientPool::Lease grpc_client =
+            _grpcClientPool->acquire(mygrpcstring);
         ::org::defi_wallet_core::Pagination defaultpagination;
-        ::org::defi_wallet_core::Collection collection =
-            grpc_client->collection(TCHAR_TO_UTF8(*denomid), defaultpagination);
+        ::org::defi_wallet_core::Collection collection = grpc.run([&]() {
+            return grpc_client->collection(TCHAR_TO_UTF8(*denomid),
+                                           defaultpagination);
+        });
 
         output.DenomOption = collection.denom_option;
         output.DenomValue = convertDenom(collection.denom_value);
@@ -179,17 +369,29 @@ void ADefiWalletCoreActor::GetNFTCollection(FString denomid,
     }
 }
 
+void ADefiWalletCoreActor::GetNFTCollectionAsync(
+    FString denomid, FCosmosNFTCollectionDelegate Out) {
+    runQueryAsync<FCosmosNFTCollection>(
+        Out, [=](FCosmosNFTCollection &output, bool &success,
+                 FString &output_message) {
+            GetNFTCollection(denomid, output, success, output_message);
+        });
+}
+
 void ADefiWalletCoreActor::GetNFTDenom(FString denomid, FCosmosNFTDenom &output,
                                        bool &success, FString &output_message) {
     try {
-        std::string mygrpcstring = TCHAR_TO_UTF8(*myGrpc);
-        rust::cxxbridge1::Box<GrpcClient> grpc_client =
-            new_grpc_client(mygrpcstring);
-        new_grpc_client(mygrpcstring);
-
-        ::org::defi_wallet_core::Denom denom =
-            grpc_client->denom(TCHAR_TO_UTF8(*denomid));
-        output = convertDenom(denom);
+        output = _singleFlight->run<FCosmosNFTDenom>(
+            flightKey("nft_denom", myGrpc, denomid), [&]() {
+                CronosEndpointCall grpc = callGrpc();
+                std::string mygrpcstring = TCHAR_TO_UTF8(*grpc.url);
+                GrpcClientPool::Lease grpc_client =
+                    _grpcClientPool->acquire(mygrpcstring);
+                ::org::defi_wallet_core::Denom denom = grpc.run([&]() {
+                    return grpc_client->denom(TCHAR_TO_UTF8(*denomid));
+                });
+                return convertDenom(denom);
+            });
 
         success = true;
     } catch (const std::exception &e) {
@@ -200,18 +402,32 @@ void ADefiWalletCoreActor::GetNFTDenom(FString denomid, FCosmosNFTDenom &output,
     }
 }
 
+void ADefiWalletCoreActor::GetNFTDenomAsync(FString denomid,
+                                            FCosmosNFTDenomDelegate Out) {
+    runQueryAsync<FCosmosNFTDenom>(
+        Out, [=](FCosmosNFTDenom &output, bool &success,
+                 FString &output_message) {
+            GetNFTDenom(denomid, output, success, output_message);
+        });
+}
+
 void ADefiWalletCoreActor::GetNFTDenomByName(FString denomname,
                                              FCosmosNFTDenom &output,
                                              bool &success,
                                              FString &output_message) {
     try {
-        std::string mygrpcstring = TCHAR_TO_UTF8(*myGrpc);
-        rust::cxxbridge1::Box<GrpcClient> grpc_client =
-            new_grpc_client(mygrpcstring);
-        new_grpc_client(mygrpcstring);
-        ::org::defi_wallet_core::Denom denom =
-            grpc_client->denom_by_name(TCHAR_TO_UTF8(*denomname));
-        output = convertDenom(denom);
+        output = _singleFlight->run<FCosmosNFTDenom>(
+            flightKey("nft_denom_by_name", myGrpc, denomname), [&]() {
+                CronosEndpointCall grpc = callGrpc();
+                std::string mygrpcstring = TCHAR_TO_UTF8(*grpc.url);
+                GrpcClientPool::Lease grpc_client =
+                    _grpcClientPool->acquire(mygrpcstring);
+                ::org::defi_wallet_core::Denom denom = grpc.run([&]() {
+                    return grpc_client->denom_by_name(
+                        TCHAR_TO_UTF8(*denomname));
+                });
+                return convertDenom(denom);
+            });
 
         success = true;
     } catch (const std::exception &e) {
@@ -222,18 +438,27 @@ void ADefiWalletCoreActor::GetNFTDenomByName(FString denomname,
     }
 }
 
+void ADefiWalletCoreActor::GetNFTDenomByNameAsync(FString denomname,
+                                                  FCosmosNFTDenomDelegate Out) {
+    runQueryAsync<FCosmosNFTDenom>(
+        Out, [=](FCosmosNFTDenom &output, bool &success,
+                 FString &output_message) {
+            GetNFTDenomByName(denomname, output, success, output_message);
+        });
+}
+
 void ADefiWalletCoreActor::GetNFTAllDenoms(TArray<FCosmosNFTDenom> &output,
                                            bool &success,
                                            FString &output_message) {
     try {
-        std::string mygrpcstring = TCHAR_TO_UTF8(*myGrpc);
-
-        rust::cxxbridge1::Box<GrpcClient> grpc_client =
-            new_grpc_client(mygrpcstring);
+        CronosEndpointCall grpc = callGrpc();
+        std::string mygrpcstring = TCHAR_TO_UTF8(*grpc.url);
+        GrpcClientPool::Lease grpc_client =
+            _grpcClientPool->acquire(mygrpcstring);
 
         ::org::defi_wallet_core::Pagination defaultpagination;
-        ::rust::Vec<::org::defi_wallet_core::Denom> denoms =
-            grpc_client->denoms(defaultpagination);
+        ::rust::Vec<::org::defi_wallet_core::Denom> denoms = grpc.run(
+            [&]() { return grpc_client->denoms(defaultpagination); });
         output.Empty();
         for (::org::defi_wallet_core::Denom &denom : denoms) {
             output.Add(convertDenom(denom));
@@ -249,21 +474,30 @@ void ADefiWalletCoreActor::GetNFTAllDenoms(TArray<FCosmosNFTDenom> &output,
     }
 }
 
+void ADefiWalletCoreActor::GetNFTAllDenomsAsync(FCosmosNFTDenomsDelegate Out) {
+    runQueryAsync<TArray<FCosmosNFTDenom>>(
+        Out, [=](TArray<FCosmosNFTDenom> &output, bool &success,
+                 FString &output_message) {
+            GetNFTAllDenoms(output, success, output_message);
+        });
+}
+
 void ADefiWalletCoreActor::GetNFTToken(FString denomid, FString tokenid,
                                        FCosmosNFTToken &output, bool &success,
                                        FString &output_message) {
     try {
-        std::string mygrpcstring = TCHAR_TO_UTF8(*myGrpc);
-        rust::cxxbridge1::Box<GrpcClient> grpc_client =
-            new_grpc_client(mygrpcstring);
-
-        ::org::defi_wallet_core::BaseNft nft =
-            grpc_client->nft(TCHAR_TO_UTF8(*denomid), TCHAR_TO_UTF8(*tokenid));
-        output.ID = UTF8_TO_TCHAR(nft.id.c_str());
-        output.Name = UTF8_TO_TCHAR(nft.name.c_str());
-        output.URI = UTF8_TO_TCHAR(nft.uri.c_str());
-        output.Data = UTF8_TO_TCHAR(nft.data.c_str());
-        output.Owner = UTF8_TO_TCHAR(nft.owner.c_str());
+        output = _singleFlight->run<FCosmosNFTToken>(
+            flightKey("nft_token", myGrpc, denomid, tokenid), [&]() {
+                CronosEndpointCall grpc = callGrpc();
+                std::string mygrpcstring = TCHAR_TO_UTF8(*grpc.url);
+                GrpcClientPool::Lease grpc_client =
+                    _grpcClientPool->acquire(mygrpcstring);
+                ::org::defi_wallet_core::BaseNft nft = grpc.run([&]() {
+                    return grpc_client->nft(TCHAR_TO_UTF8(*denomid),
+                                            TCHAR_TO_UTF8(*tokenid));
+                });
+                return convertToken(nft);
+            });
         success = true;
     } catch (const std::exception &e) {
         success = false;
@@ -273,6 +507,114 @@ void ADefiWalletCoreActor::GetNFTToken(FString denomid, FString tokenid,
     }
 }
 
+void ADefiWalletCoreActor::GetNFTTokenAsync(FString denomid, FString tokenid,
+                                            FCosmosNFTTokenDelegate Out) {
+    runQueryAsync<FCosmosNFTToken>(
+        Out, [=](FCosmosNFTToken &output, bool &success,
+                 FString &output_message) {
+            GetNFTToken(denomid, tokenid, output, success, output_message);
+        });
+}
+
+void ADefiWalletCoreActor::GetGrpcClientPoolStats(int64 &reused,
+                                                  int64 &created) {
+    reused = (int64)_grpcClientPool->getReusedCount();
+    created = (int64)_grpcClientPool->getCreatedCount();
+}
+
+int64 ADefiWalletCoreActor::GetCoalescedRequestCount() {
+    return (int64)(getRpcBatcher()->getCoalescedCount() +
+                   _singleFlight->getCoalescedCount());
+}
+
+TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe>
+ADefiWalletCoreActor::getRpcBatcher() {
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> batcher =
+        CronosRpcBatcher::forEndpoint(myCronosRpc);
+    batcher->setMaxBatchSize(myRpcBatchSize);
+    batcher->setFlushInterval(myRpcBatchInterval);
+    batcher->setHedgeBudget(myRpcHedgeBudget);
+    return batcher;
+}
+
+TSharedRef<ReadCache, ESPMode::ThreadSafe>
+ADefiWalletCoreActor::getReadCache() {
+    _readCache->setTtl(myReadCacheTtl);
+    return _readCache.ToSharedRef();
+}
+
+void ADefiWalletCoreActor::invalidateReads(int32 walletIndex,
+                                           const FString &address) {
+    // the sender paid gas, its eth balance changed too
+    try {
+        _readCache->invalidate(
+            getWalletAddress(CoinType::Ethereum, walletIndex));
+    } catch (const std::exception &) {
+        // no wallet or invalid wallet index, nothing cached for it
+    }
+    _readCache->invalidate(address);
+}
+
+void ADefiWalletCoreActor::resyncEthNonce(int32 walletIndex) {
+    try {
+        std::string address = TCHAR_TO_UTF8(
+            *getWalletAddress(CoinType::Ethereum, walletIndex));
+        _nonceManager->resync(address, myCronosChainID);
+    } catch (const std::exception &) {
+        // no wallet or invalid wallet index, nothing to resync
+    }
+}
+
+TSharedRef<CronosBroadcastQueue, ESPMode::ThreadSafe>
+ADefiWalletCoreActor::getBroadcastQueue() {
+    // the queue shares the batcher of myCronosRpc, apply its settings
+    getRpcBatcher();
+    TSharedRef<CronosBroadcastQueue, ESPMode::ThreadSafe> queue =
+        CronosBroadcastQueue::forEndpoint(myCronosRpc);
+    queue->setMaxInFlight(myBroadcastMaxInFlight);
+    queue->setRateLimit(myBroadcastRateLimit,
+                        FMath::CeilToInt(myBroadcastRateLimit));
+    queue->setMaxQueued(myBroadcastMaxQueued);
+    return queue;
+}
+
+TSharedRef<CronosReceiptWatcher, ESPMode::ThreadSafe>
+ADefiWalletCoreActor::getReceiptWatcher() {
+    // the watcher sends through the queue of myCronosRpc, apply its settings
+    getBroadcastQueue();
+    TSharedRef<CronosReceiptWatcher, ESPMode::ThreadSafe> watcher =
+        CronosReceiptWatcher::forEndpoint(myCronosRpc);
+    watcher->setPollInterval(myReceiptPollInterval);
+    watcher->setTimeout(myReceiptTimeout);
+    watcher->setBlockClock(_blockClock);
+    return watcher;
+}
+
+TSharedRef<CronosGasEstimator, ESPMode::ThreadSafe>
+ADefiWalletCoreActor::getGasEstimator() {
+    // the estimator shares the batcher of myCronosRpc, apply its settings
+    getRpcBatcher();
+    TSharedRef<CronosGasEstimator, ESPMode::ThreadSafe> estimator =
+        CronosGasEstimator::forEndpoint(myCronosRpc);
+    estimator->setMargin(myGasLimitMargin);
+    return estimator;
+}
+
+TSharedRef<CronosGasOracle, ESPMode::ThreadSafe>
+ADefiWalletCoreActor::getGasOracle() {
+    // the oracle shares the batcher of myCronosRpc, apply its settings
+    getRpcBatcher();
+    TSharedRef<CronosGasOracle, ESPMode::ThreadSafe> oracle =
+        CronosGasOracle::forEndpoint(myCronosRpc);
+    oracle->setTtl(myGasPriceTtl);
+    return oracle;
+}
+
+FString ADefiWalletCoreActor::getMulticallAddress() const {
+    const FString *found = myMulticallAddresses.Find(myCronosChainID);
+    return found != NULL ? *found : FString(CronosMulticall::DefaultAddress);
+}
+
 void ADefiWalletCoreActor::SendAmount(int32 walletIndex, FString fromaddress,
                                       FString toaddress, int64 amount,
                                       FString amountdenom, FString &output,
@@ -294,44 +636,52 @@ void ADefiWalletCoreActor::SendAmount(int32 walletIndex, FString fromaddress,
         std::string myto = TCHAR_TO_UTF8(*toaddress);
         uint64 myamount = (uint64)amount;
         std::string myamountdenom = TCHAR_TO_UTF8(*amountdenom);
+        // the account is cached per endpoint list, not per endpoint
         std::string myservercosmos =
             TCHAR_TO_UTF8(*myCosmosRpc); /* 1317 port */
+        // a broadcast may wait for the node, only its outcome is reported
+        CronosEndpointCall tendermint = callTendermintRpc(false);
         std::string myservertendermint =
-            TCHAR_TO_UTF8(*myTendermintRpc); /* 26657 port */
+            TCHAR_TO_UTF8(*tendermint.url); /* 26657 port */
         UE_LOG(LogTemp, Log,
                TEXT("CronosPlayUnreal SendAmount from %s to %s amount %lld %s"),
                UTF8_TO_TCHAR(myfrom.c_str()), UTF8_TO_TCHAR(myto.c_str()),
                myamount, UTF8_TO_TCHAR(myamountdenom.c_str()));
 
-        rust::cxxbridge1::String result =
-            _coreWallet->get_default_address(CoinType::CryptoOrgMainnet);
-
-        rust::cxxbridge1::String detailjson =
-            query_account_details(myservercosmos, myfrom);
-
-        org::defi_wallet_core::CosmosAccountInfoRaw detailinfo =
-            query_account_details_info(myservercosmos, myfrom);
-        tx_info.account_number = detailinfo.account_number;
-        tx_info.sequence_number = detailinfo.sequence_number;
         tx_info.chain_id = mychainid;
-        char hdpath[100];
-        // m / purpose' / coin_type' / account' / change / address_index
-        snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d", tx_info.coin_type,
-                 walletIndex);
-        rust::cxxbridge1::Box<org::defi_wallet_core::PrivateKey> privatekey =
-            _coreWallet->get_key(hdpath);
-
-        rust::cxxbridge1::Vec<uint8_t> signedtx =
-            get_single_bank_send_signed_tx(tx_info, *privatekey, myto, myamount,
-                                           myamountdenom);
+        PrivateKeyCache::Handle privatekey =
+            getPrivateKey(tx_info.coin_type, walletIndex);
 
+        // account number and sequence are cached, not queried per send
         ::org::defi_wallet_core::CosmosTransactionReceiptRaw broadcastResult =
-            broadcast_tx(myservertendermint, signedtx);
+            _cosmosAccountCache->send(
+                myfrom, myservercosmos,
+                [&](const CosmosAccountInfoRaw &accountinfo) {
+                    tx_info.account_number = accountinfo.account_number;
+                    tx_info.sequence_number = accountinfo.sequence_number;
+                    rust::cxxbridge1::Vec<uint8_t> signedtx =
+                        get_single_bank_send_signed_tx(tx_info, **privatekey,
+                                                       myto, myamount,
+                                                       myamountdenom);
+                    return tendermint.run([&]() {
+                        return broadcast_tx(myservertendermint, signedtx);
+                    });
+                });
         rust::cxxbridge1::String txhash = broadcastResult.tx_hash_hex;
 
         UE_LOG(LogTemp, Log, TEXT("CronosPlayUnreal BroadcastTX Result %s"),
                UTF8_TO_TCHAR(txhash.c_str()));
 
+        if (broadcastResult.code != 0) {
+            // rejected by the node, e.g. account sequence mismatch
+            success = false;
+            output = UTF8_TO_TCHAR(txhash.c_str());
+            output_message = FString::Printf(
+                TEXT("CronosPlayUnreal SendAmount Error: code %u %s"),
+                broadcastResult.code,
+                UTF8_TO_TCHAR(broadcastResult.log.c_str()));
+            return;
+        }
         success = true;
         output = UTF8_TO_TCHAR(txhash.c_str());
     } catch (const std::exception &e) {
@@ -342,10 +692,166 @@ void ADefiWalletCoreActor::SendAmount(int32 walletIndex, FString fromaddress,
     }
 }
 
+void ADefiWalletCoreActor::SendAmounts(int32 walletIndex, FString fromaddress,
+                                       const TArray<FCosmosBankSend> &sends,
+                                       FString amountdenom,
+                                       TArray<FString> &output, bool &success,
+                                       FString &output_message) {
+    output.Empty();
+    try {
+        if (NULL == _coreWallet) {
+            success = false;
+            output_message = TEXT("Invalid Wallet");
+            return;
+        }
+        CosmosSequentialTxBuilder builder;
+        addBankSends(builder, sends, amountdenom);
+
+        std::string myfrom = TCHAR_TO_UTF8(*fromaddress);
+        std::string myservercosmos = TCHAR_TO_UTF8(*myCosmosRpc);
+        // a broadcast may wait for the node, only its outcome is reported
+        CronosEndpointCall tendermint = callTendermintRpc(false);
+        std::string myservertendermint = TCHAR_TO_UTF8(*tendermint.url);
+        PrivateKeyCache::Handle privatekey =
+            getPrivateKey(builder.info.coin_type, walletIndex);
+        UE_LOG(LogTemp, Log,
+               TEXT("CronosPlayUnreal SendAmounts from %s to %d recipients"),
+               *fromaddress, sends.Num());
+
+        for (size_t i = 0; i < builder.size(); i++) {
+            ::org::defi_wallet_core::CosmosTransactionReceiptRaw
+                broadcastResult = _cosmosAccountCache->send(
+                    myfrom, myservercosmos,
+                    [&](const CosmosAccountInfoRaw &accountinfo) {
+                        rust::cxxbridge1::Vec<uint8_t> signedtx =
+                            builder.sign(i, **privatekey, accountinfo);
+                        return tendermint.run([&]() {
+                            return broadcast_tx(myservertendermint, signedtx);
+                        });
+                    });
+            output.Add(UTF8_TO_TCHAR(broadcastResult.tx_hash_hex.c_str()));
+            if (broadcastResult.code != 0) {
+                // later txs are not sent, their sequences would not be used
+                success = false;
+                output_message = FString::Printf(
+                    TEXT("CronosPlayUnreal SendAmounts Error: tx %d code %u "
+                         "%s"),
+                    (int32)i, broadcastResult.code,
+                    UTF8_TO_TCHAR(broadcastResult.log.c_str()));
+                return;
+            }
+        }
+        success = true;
+        output_message = TEXT("");
+    } catch (const std::exception &e) {
+        success = false;
+        output_message =
+            FString::Printf(TEXT("CronosPlayUnreal SendAmounts Error: %s"),
+                            UTF8_TO_TCHAR(e.what()));
+    }
+}
+
+void ADefiWalletCoreActor::SendAmountsAsync(
+    int32 walletIndex, FString fromaddress,
+    const TArray<FCosmosBankSend> &sends, FString amountdenom,
+    FWalletQueryStringArrayDelegate Out) {
+    runQueryAsync<TArray<FString>>(
+        Out, [=](TArray<FString> &output, bool &success,
+                 FString &output_message) {
+            SendAmounts(walletIndex, fromaddress, sends, amountdenom, output,
+                        success, output_message);
+        });
+}
+
+void ADefiWalletCoreActor::addBankSends(CosmosSequentialTxBuilder &builder,
+                                        const TArray<FCosmosBankSend> &sends,
+                                        FString amountdenom) {
+    TxDirector director;
+    director.setBuilder(&builder);
+    builder.info = director.makeTx();
+    builder.info.chain_id = TCHAR_TO_UTF8(*myChainID);
+
+    std::string myamountdenom = TCHAR_TO_UTF8(*amountdenom);
+    for (const FCosmosBankSend &send : sends) {
+        if (send.Amount <= 0) {
+            throw std::runtime_error("Invalid amount " +
+                                     std::to_string(send.Amount) + " to " +
+                                     TCHAR_TO_UTF8(*send.ToAddress));
+        }
+        builder.addBankSend(TCHAR_TO_UTF8(*send.ToAddress), (uint64)send.Amount,
+                            myamountdenom);
+    }
+}
+
+void ADefiWalletCoreActor::SendAmountsPipelinedAsync(
+    int32 walletIndex, FString fromaddress,
+    const TArray<FCosmosBankSend> &sends, FString amountdenom,
+    FWalletQueryStringArrayDelegate Out) {
+    // settings are read on the game thread
+    TSharedRef<CosmosSendPipeline, ESPMode::ThreadSafe> pipeline =
+        MakeShared<CosmosSendPipeline, ESPMode::ThreadSafe>(
+            myTendermintRpc, myCosmosRpc, fromaddress);
+    pipeline->setWindow(myCosmosSendWindow);
+    pipeline->setAsyncBroadcast(myCosmosBroadcastAsync);
+    pipeline->setPollInterval(myReceiptPollInterval);
+    pipeline->setTimeout(myReceiptTimeout);
+    std::string myfrom = TCHAR_TO_UTF8(*fromaddress);
+    std::string myservercosmos = TCHAR_TO_UTF8(*myCosmosRpc);
+
+    runQueryAsync<TArray<FString>>(
+        Out, [=](TArray<FString> &output, bool &success,
+                 FString &output_message) {
+            try {
+                if (NULL == _coreWallet) {
+                    success = false;
+                    output_message = TEXT("Invalid Wallet");
+                    return;
+                }
+                CosmosSequentialTxBuilder builder;
+                addBankSends(builder, sends, amountdenom);
+                PrivateKeyCache::Handle privatekey =
+                    getPrivateKey(builder.info.coin_type, walletIndex);
+
+                FString error;
+                _cosmosAccountCache->exclusive(
+                    myfrom, myservercosmos, [&](CosmosAccountInfoRaw &info) {
+                        bool synced = true;
+                        output = pipeline->run(
+                            (int32)builder.size(), info,
+                            [&](int32 index,
+                                const CosmosAccountInfoRaw &accountinfo) {
+                                return builder.sign(index, **privatekey,
+                                                    accountinfo);
+                            },
+                            synced, error);
+                        return synced;
+                    });
+                success = error.IsEmpty();
+                if (!success) {
+                    output_message = FString::Printf(
+                        TEXT("CronosPlayUnreal SendAmountsPipelinedAsync "
+                             "Error: %s"),
+                        *error);
+                }
+            } catch (const std::exception &e) {
+                success = false;
+                output_message = FString::Printf(
+                    TEXT("CronosPlayUnreal SendAmountsPipelinedAsync Error: "
+                         "%s"),
+                    UTF8_TO_TCHAR(e.what()));
+            }
+        });
+}
+
 void ADefiWalletCoreActor::DestroyWallet() {
     UE_LOG(LogTemp, Log, TEXT("ADefiWalletCoreActor  DestroyWallet"));
+    // waits for the workers still using the wallet
+    FRWScopeLock walletlock(_walletLock, SLT_Write);
     if (_coreWallet != NULL) {
         UE_LOG(LogTemp, Log, TEXT("ADefiWalletCoreActor  Removed CoreWallet"));
+        // keys derived from the wallet go first
+        _privateKeyCache->clear();
+        _addressCache->clear();
 
         // restored back
         rust::cxxbridge1::Box<org::defi_wallet_core::Wallet> tmpwallet =
@@ -367,8 +873,7 @@ void ADefiWalletCoreActor::CreateWallet(FString mnemonics, FString password) {
     if (NULL == _coreWallet) {
         rust::cxxbridge1::Box<org::defi_wallet_core::Wallet> tmpWallet =
             restore_wallet(TCHAR_TO_UTF8(*mnemonics), TCHAR_TO_UTF8(*password));
-        // ownership transferred
-        _coreWallet = tmpWallet.into_raw();
+        adoptWallet(std::move(tmpWallet));
     }
 }
 
@@ -495,7 +1000,7 @@ void ADefiWalletCoreActor::RestoreWalletSaveToSecureStorage(
         rust::cxxbridge1::Box<org::defi_wallet_core::Wallet> tmpWallet =
             restore_wallet(TCHAR_TO_UTF8(*mnemonics), TCHAR_TO_UTF8(*password));
 
-        _coreWallet = tmpWallet.into_raw();
+        adoptWallet(std::move(tmpWallet));
         assert(_coreWallet != NULL);
         rust::cxxbridge1::String result =
             _coreWallet->get_address(CoinType::CryptoOrgMainnet, 0);
@@ -549,7 +1054,7 @@ void ADefiWalletCoreActor::RestoreWalletLoadFromSecureStorage(
         FString password = infojsonobject->GetStringField(TEXT("password"));
         rust::cxxbridge1::Box<org::defi_wallet_core::Wallet> tmpWallet =
             restore_wallet(TCHAR_TO_UTF8(*mnemonics), TCHAR_TO_UTF8(*password));
-        _coreWallet = tmpWallet.into_raw();
+        adoptWallet(std::move(tmpWallet));
         assert(_coreWallet != NULL);
         rust::cxxbridge1::String result =
             _coreWallet->get_address(CoinType::CryptoOrgMainnet, 0);
@@ -581,7 +1086,7 @@ void ADefiWalletCoreActor::RestoreWalletSaveToSecureStorage(
             restore_wallet_save_to_securestorage(
                 TCHAR_TO_UTF8(*mnemonics), TCHAR_TO_UTF8(*password),
                 TCHAR_TO_UTF8(*servicename), TCHAR_TO_UTF8(*username));
-        _coreWallet = tmpWallet.into_raw();
+        adoptWallet(std::move(tmpWallet));
 
         assert(_coreWallet != NULL);
         rust::cxxbridge1::String result =
@@ -610,7 +1115,7 @@ void ADefiWalletCoreActor::RestoreWalletLoadFromSecureStorage(
         rust::cxxbridge1::Box<org::defi_wallet_core::Wallet> tmpWallet =
             restore_wallet_load_from_securestorage(TCHAR_TO_UTF8(*servicename),
                                                    TCHAR_TO_UTF8(*username));
-        _coreWallet = tmpWallet.into_raw();
+        adoptWallet(std::move(tmpWallet));
 
         assert(_coreWallet != NULL);
         rust::cxxbridge1::String result =
@@ -666,8 +1171,7 @@ void ADefiWalletCoreActor::InitializeNewWallet(FString password,
         }
         rust::cxxbridge1::Box<org::defi_wallet_core::Wallet> tmpWallet =
             new_wallet(TCHAR_TO_UTF8(*password), mywordcount);
-        // ownership transferred
-        _coreWallet = tmpWallet.into_raw();
+        adoptWallet(std::move(tmpWallet));
 
         assert(_coreWallet != NULL);
         rust::cxxbridge1::String result =
@@ -780,9 +1284,7 @@ void ADefiWalletCoreActor::GetAddress(int32 index, FString &output,
         }
 
         assert(_coreWallet != NULL);
-        rust::cxxbridge1::String result =
-            _coreWallet->get_address(CoinType::CryptoOrgMainnet, index);
-        output = UTF8_TO_TCHAR(result.c_str());
+        output = getWalletAddress(CoinType::CryptoOrgMainnet, index);
         success = true;
     } catch (const std::exception &e) {
         success = false;
@@ -804,9 +1306,13 @@ void ADefiWalletCoreActor::GetBalance(FString address, FString denom,
         }
         assert(_coreWallet != NULL);
 
-        std::string myservergrpc = TCHAR_TO_UTF8(*myGrpc); /* 1316 port */
-        rust::cxxbridge1::String balance = query_account_balance(
-            myservergrpc, TCHAR_TO_UTF8(*address), TCHAR_TO_UTF8(*denom));
+        CronosEndpointCall grpc = callGrpc();
+        std::string myservergrpc =
+            TCHAR_TO_UTF8(*grpc.url); /* 1316 port */
+        rust::cxxbridge1::String balance = grpc.run([&]() {
+            return query_account_balance(myservergrpc, TCHAR_TO_UTF8(*address),
+                                         TCHAR_TO_UTF8(*denom));
+        });
 
         output = UTF8_TO_TCHAR(balance.c_str());
         success = true;
@@ -819,6 +1325,14 @@ void ADefiWalletCoreActor::GetBalance(FString address, FString denom,
     }
 }
 
+void ADefiWalletCoreActor::GetBalanceAsync(FString address, FString denom,
+                                           FWalletQueryStringDelegate Out) {
+    runQueryAsync<FString>(
+        Out, [=](FString &output, bool &success, FString &output_message) {
+            GetBalance(address, denom, output, success, output_message);
+        });
+}
+
 void ADefiWalletCoreActor::GetEthAddress(int32 index, FString &output,
                                          bool &success,
                                          FString &output_message) {
@@ -830,8 +1344,7 @@ void ADefiWalletCoreActor::GetEthAddress(int32 index, FString &output,
         }
 
         assert(_coreWallet != NULL);
-        rust::cxxbridge1::String result = _coreWallet->get_eth_address(index);
-        output = UTF8_TO_TCHAR(result.c_str());
+        output = getWalletAddress(CoinType::Ethereum, index);
         success = true;
     } catch (const std::exception &e) {
         success = false;
@@ -842,15 +1355,89 @@ void ADefiWalletCoreActor::GetEthAddress(int32 index, FString &output,
     }
 }
 
+// same order as EWalletCoinType
+static CoinType walletCoinType(EWalletCoinType coin) {
+    switch (coin) {
+    case EWalletCoinType::CryptoOrgMainnet:
+        return CoinType::CryptoOrgMainnet;
+    case EWalletCoinType::CryptoOrgTestnet:
+        return CoinType::CryptoOrgTestnet;
+    case EWalletCoinType::CronosMainnet:
+        return CoinType::CronosMainnet;
+    case EWalletCoinType::CosmosHub:
+        return CoinType::CosmosHub;
+    case EWalletCoinType::Ethereum:
+        return CoinType::Ethereum;
+    default:
+        throw std::runtime_error("Invalid Coin Type");
+    }
+}
+
+void ADefiWalletCoreActor::DeriveAddresses(EWalletCoinType coin,
+                                           int32 startIndex, int32 count,
+                                           TArray<FString> &output,
+                                           bool &success,
+                                           FString &output_message) {
+    try {
+        // DestroyWallet waits for the derivation, not the other way round
+        FRWScopeLock walletlock(_walletLock, SLT_ReadOnly);
+        if (NULL == _coreWallet) {
+            success = false;
+            output_message = TEXT("Invalid Wallet");
+            return;
+        }
+
+        if (myPersistAddressCache) {
+            // loaded once per wallet, later ranges start from the file
+            _addressCache->attach(
+                *_coreWallet,
+                FPaths::Combine(FPaths::ProjectSavedDir(),
+                                TEXT("CronosPlayUnreal")));
+        }
+        output = _addressCache->derive(*_coreWallet, walletCoinType(coin),
+                                       startIndex, count);
+        _addressCache->save();
+        success = true;
+    } catch (const std::exception &e) {
+        success = false;
+        output.Empty();
+        output_message =
+            FString::Printf(TEXT("CronosPlayUnreal DeriveAddresses Error: %s"),
+                            UTF8_TO_TCHAR(e.what()));
+    }
+}
+
+void ADefiWalletCoreActor::DeriveAddressesAsync(
+    EWalletCoinType coin, int32 startIndex, int32 count,
+    FWalletQueryStringArrayDelegate Out) {
+    runQueryAsync<TArray<FString>>(
+        Out, [=](TArray<FString> &output, bool &success,
+                 FString &output_message) {
+            DeriveAddresses(coin, startIndex, count, output, success,
+                            output_message);
+        });
+}
+
 void ADefiWalletCoreActor::GetEthBalance(FString address, FString &output,
                                          bool &success,
                                          FString &output_message) {
     try {
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        TSharedRef<ReadCache, ESPMode::ThreadSafe> readcache = getReadCache();
+        FString key = ReadCache::readKey(myCronosChainID, TEXT("GetEthBalance"),
+                                         FString(), address);
+        if (readcache->get(key, output)) {
+            success = true;
+            return;
+        }
+        uint64 generation = readcache->begin();
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         std::string targetaddress = TCHAR_TO_UTF8(*address);
-        rust::cxxbridge1::String result =
-            get_eth_balance(targetaddress, mycronosrpc).to_string();
+        rust::cxxbridge1::String result = rpc.run([&]() {
+            return get_eth_balance(targetaddress, mycronosrpc).to_string();
+        });
         output = UTF8_TO_TCHAR(result.c_str());
+        readcache->put(key, output, generation);
         success = true;
     } catch (const std::exception &e) {
         success = false;
@@ -861,41 +1448,190 @@ void ADefiWalletCoreActor::GetEthBalance(FString address, FString &output,
     }
 }
 
+void ADefiWalletCoreActor::GetEthBalanceAsync(FString address,
+                                              FWalletQueryStringDelegate Out) {
+    FString params;
+    try {
+        params = FString::Printf(TEXT("[\"%s\",\"latest\"]"),
+                                 *CronosAbi::normalizeAddress(address));
+    } catch (const std::exception &e) {
+        FString output_message = FString::Printf(
+            TEXT("CronosPlayUnreal GetEthBalanceAsync Error: %s"),
+            UTF8_TO_TCHAR(e.what()));
+        AsyncTask(ENamedThreads::GameThread, [Out, output_message]() {
+            Out.ExecuteIfBound(TEXT(""), output_message);
+        });
+        return;
+    }
+    TSharedRef<ReadCache, ESPMode::ThreadSafe> readcache = getReadCache();
+    FString key = ReadCache::readKey(myCronosChainID, TEXT("GetEthBalance"),
+                                     FString(), address);
+    if (deliverCached(*readcache, key, Out)) {
+        return;
+    }
+    uint64 generation = readcache->begin();
+    rpcCallBatched<FString>(
+        getRpcBatcher(), TEXT("GetEthBalanceAsync"), TEXT("eth_getBalance"),
+        params,
+        [readcache, key, generation](const FString &data) {
+            FString value = CronosAbi::toDecimal(data);
+            readcache->put(key, value, generation);
+            return value;
+        },
+        Out);
+}
+
+void ADefiWalletCoreActor::GetGasPriceAsync(int32 percentile,
+                                            FWalletQueryStringDelegate Out) {
+    TSharedRef<CronosGasOracle, ESPMode::ThreadSafe> oracle = getGasOracle();
+    runQueryAsync<FString>(Out, [oracle, percentile](FString &output,
+                                                     bool &success,
+                                                     FString &result) {
+        FString error;
+        uint64 price = oracle->getGasPrice(percentile, error);
+        success = error.IsEmpty();
+        if (success) {
+            output = FString::Printf(TEXT("%llu"), price);
+        } else {
+            result = FString::Printf(
+                TEXT("CronosPlayUnreal GetGasPriceAsync Error: %s"), *error);
+        }
+    });
+}
+
 void ADefiWalletCoreActor::BroadcastEthTxAsync(FWalletBroadcastDelegate Out,
                                                TArray<uint8> usersignedtx,
                                                FString rpc) {
-    AsyncTask(
-        ENamedThreads::AnyHiPriThreadNormalTask, [Out, usersignedtx, rpc]() {
-            rust::Vec<::std::uint8_t> signedtx;
-            for (int i = 0; i < usersignedtx.Num(); i++) {
-                signedtx.push_back(usersignedtx[i]);
-            }
-            assert(signedtx.size() == usersignedtx.size());
-
-            std::string mycronosrpc = TCHAR_TO_UTF8(*rpc);
-
+    CronosReceiptWatcher::forEndpoint(rpc)->send(
+        usersignedtx, [Out](FString txhash, FString error) {
             FString txhashtext;
             FString result;
-            try {
-                ::org::defi_wallet_core::CronosTransactionReceiptRaw receipt =
-                    broadcast_eth_signed_raw_tx(signedtx, mycronosrpc, 1000);
-
-                std::string txhash = to_hex(receipt.transaction_hash.data(),
-                                            receipt.transaction_hash.size());
-
-                txhashtext = UTF8_TO_TCHAR(txhash.c_str());
-            } catch (const std::exception &e) {
+            if (error.IsEmpty()) {
+                txhashtext = txhash.StartsWith(TEXT("0x"))
+                                 ? txhash.RightChop(2).ToLower()
+                                 : txhash.ToLower();
+            } else {
                 result = FString::Printf(
                     TEXT("CronosPlayUnreal BroadcastEthTxAsync Error: %s"),
-                    UTF8_TO_TCHAR(e.what()));
+                    *error);
             }
+            Out.ExecuteIfBound(txhashtext, result);
+        });
+}
 
-            AsyncTask(ENamedThreads::GameThread, [Out, txhashtext, result]() {
-                Out.ExecuteIfBound(txhashtext, result);
-            });
+void ADefiWalletCoreActor::WatchEthReceiptAsync(FString txhash,
+                                                FSendEthTransferDelegate Out) {
+    FString mytxhash =
+        txhash.StartsWith(TEXT("0x")) ? txhash : TEXT("0x") + txhash;
+    getReceiptWatcher()->watch(
+        mytxhash, [Out](FCronosTransactionReceiptRaw receipt, FString error) {
+            if (!error.IsEmpty()) {
+                error = FString::Printf(
+                    TEXT("CronosPlayUnreal WatchEthReceiptAsync Error: %s"),
+                    *error);
+            }
+            Out.ExecuteIfBound(receipt, error);
         });
 }
 
+void ADefiWalletCoreActor::StartBlockClock() {
+    if (_blockClock.IsValid()) {
+        return;
+    }
+    // the clock shares the batcher of myCronosRpc, apply its settings
+    getRpcBatcher();
+    _blockClock = CronosBlockClock::forEndpoint(myCronosRpc);
+    _blockClock->setWebSocketUrl(myCronosWebSocketRpc);
+    _blockClock->setPollInterval(myBlockPollInterval);
+    _blockClockHandle = _blockClock->subscribe(
+        CronosBlockClock::FOnBlock::FDelegate::CreateUObject(
+            this, &ADefiWalletCoreActor::onNewBlock));
+}
+
+void ADefiWalletCoreActor::StopBlockClock() {
+    if (!_blockClock.IsValid()) {
+        return;
+    }
+    _blockClock->unsubscribe(_blockClockHandle);
+    _blockClock.Reset();
+    _blockClockHandle.Reset();
+}
+
+int32 ADefiWalletCoreActor::GetBroadcastQueueDepth() {
+    return CronosBroadcastQueue::forEndpoint(myCronosRpc)->getQueueDepth();
+}
+
+int64 ADefiWalletCoreActor::GetBlockNumber() {
+    return (int64)CronosBlockClock::forEndpoint(myCronosRpc)->getBlockNumber();
+}
+
+TSharedRef<CronosNftIndexer, ESPMode::ThreadSafe>
+ADefiWalletCoreActor::getNftIndexer() {
+    // the indexer shares the batcher and clock of myCronosRpc
+    getRpcBatcher();
+    TSharedRef<CronosBlockClock, ESPMode::ThreadSafe> clock =
+        CronosBlockClock::forEndpoint(myCronosRpc);
+    clock->setWebSocketUrl(myCronosWebSocketRpc);
+    clock->setPollInterval(myBlockPollInterval);
+    TSharedRef<CronosNftIndexer, ESPMode::ThreadSafe> indexer =
+        CronosNftIndexer::forEndpoint(myCronosRpc);
+    indexer->setChunkSize(myNftIndexChunkBlocks);
+    indexer->setCheckpointFile(FPaths::Combine(
+        FPaths::ProjectSavedDir(), TEXT("CronosPlayUnreal"),
+        FString::Printf(TEXT("nftindex_%lld.txt"), (int64)myCronosChainID)));
+    return indexer;
+}
+
+void ADefiWalletCoreActor::StartNftIndexer(const TArray<FString> &contracts,
+                                           int64 fromBlock, bool &success,
+                                           FString &output_message) {
+    try {
+        if (fromBlock < 0) {
+            throw std::runtime_error("Invalid block " +
+                                     std::to_string(fromBlock));
+        }
+        _nftIndexer = getNftIndexer();
+        for (const FString &contract : contracts) {
+            _nftIndexer->addContract(contract, (uint64)fromBlock);
+        }
+        success = true;
+    } catch (const std::exception &e) {
+        success = false;
+        output_message =
+            FString::Printf(TEXT("CronosPlayUnreal StartNftIndexer Error: %s"),
+                            UTF8_TO_TCHAR(e.what()));
+    }
+}
+
+void ADefiWalletCoreActor::StopNftIndexer() {
+    if (!_nftIndexer.IsValid()) {
+        return;
+    }
+    _nftIndexer->stop();
+    _nftIndexer.Reset();
+}
+
+void ADefiWalletCoreActor::GetIndexedNftTokens(FString contractAddress,
+                                               FString ownerAddress,
+                                               TArray<FString> &tokenIDs,
+                                               bool &synced) {
+    tokenIDs = CronosNftIndexer::forEndpoint(myCronosRpc)
+                   ->getTokens(contractAddress, ownerAddress, synced);
+}
+
+FString ADefiWalletCoreActor::GetIndexedNftOwner(FString contractAddress,
+                                                 FString tokenID) {
+    return CronosNftIndexer::forEndpoint(myCronosRpc)
+        ->getOwner(contractAddress, tokenID);
+}
+
+void ADefiWalletCoreActor::onNewBlock(uint64 blocknumber) {
+    // sampled again on the next read
+    CronosGasOracle::forEndpoint(myCronosRpc)->invalidate();
+    _readCache->onNewBlock(blocknumber);
+    OnNewBlock.Broadcast((int64)blocknumber);
+}
+
 auto toLower(std::string strToConvert) -> std::string {
     std::transform(strToConvert.begin(), strToConvert.end(),
                    strToConvert.begin(), ::tolower);
@@ -910,71 +1646,67 @@ void ADefiWalletCoreActor::SendEthAmount(
     int32 walletIndex, FString fromaddress, FString toaddress,
     FString amountInEthDecimal, FString gasLimit, FString gasPriceInWei,
     TArray<uint8> txdata, FSendEthTransferDelegate Out) {
+    TSharedRef<CronosReceiptWatcher, ESPMode::ThreadSafe> watcher =
+        getReceiptWatcher();
+    TSharedRef<CronosGasEstimator, ESPMode::ThreadSafe> estimator =
+        getGasEstimator();
+    TSharedPtr<NonceManager, ESPMode::ThreadSafe> noncemanager = _nonceManager;
+    TSharedRef<ReadCache, ESPMode::ThreadSafe> readcache = getReadCache();
+    uint64_t chainid = myCronosChainID;
 
     AsyncTask(ENamedThreads::AnyHiPriThreadNormalTask, [this, Out, walletIndex,
                                                         fromaddress, toaddress,
                                                         amountInEthDecimal,
                                                         gasLimit, gasPriceInWei,
-                                                        txdata]() {
+                                                        txdata, watcher,
+                                                        estimator, noncemanager,
+                                                        readcache, chainid]() {
+        bool success = false;
         FString result;
-        FCronosTransactionReceiptRaw txresult;
-
-        try {
-            rust::cxxbridge1::String myfromaddress =
-                _coreWallet->get_eth_address(walletIndex);
-            rust::cxxbridge1::String mytoaddress = TCHAR_TO_UTF8(*toaddress);
-
-            if (NULL == _coreWallet) {
-                result = TEXT("Invalid Wallet");
-            } else if (!isSameAddress(myfromaddress.c_str(),
-                                      TCHAR_TO_UTF8(*fromaddress))) {
-                result = TEXT("Invalid From Address");
-            } else {
-                std::string mycronosrpc =
-                    TCHAR_TO_UTF8(*myCronosRpc); /* 8545 port */
-
-                rust::cxxbridge1::String nonce1 =
-                    get_eth_nonce(myfromaddress.c_str(), mycronosrpc);
-                char hdpath[100];
-                snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d",
-                         EthCoinType, walletIndex);
-                rust::cxxbridge1::Box<PrivateKey> privatekey =
-                    _coreWallet->get_key(hdpath);
-                rust::cxxbridge1::Vec<uint8_t> data;
-                org::defi_wallet_core::EthTxInfoRaw eth_tx_info =
-                    new_eth_tx_info();
-                eth_tx_info.to_address = mytoaddress.c_str();
-                eth_tx_info.nonce = nonce1;
-                eth_tx_info.gas_limit = TCHAR_TO_UTF8(*gasLimit);
-                eth_tx_info.gas_price = TCHAR_TO_UTF8(*gasPriceInWei);
-
-                eth_tx_info.amount = TCHAR_TO_UTF8(*amountInEthDecimal);
-                eth_tx_info.amount_unit =
-                    org::defi_wallet_core::EthAmount::EthDecimal;
-
-                // data
-                eth_tx_info.data.clear();
-                for (int i = 0; i < txdata.Num(); i++) {
-                    eth_tx_info.data.push_back(txdata[i]);
-                }
-                assert(eth_tx_info.data.size() == txdata.Num());
-
-                rust::Vec<::std::uint8_t> signedtx = build_eth_signed_tx(
-                    eth_tx_info, (uint64)myCronosChainID, false, *privatekey);
-                ::org::defi_wallet_core::CronosTransactionReceiptRaw receipt =
-                    broadcast_eth_signed_raw_tx(signedtx, mycronosrpc, 1000);
-
-                convertCronosTXReceipt(receipt, txresult);
-            }
-        } catch (const std::exception &e) {
-            result =
-                FString::Printf(TEXT("CronosPlayUnreal SendAmount Error: %s"),
-                                UTF8_TO_TCHAR(e.what()));
+        TArray<uint8> signedtx = SignEthAmount(
+            walletIndex, fromaddress, toaddress, amountInEthDecimal, gasLimit,
+            gasPriceInWei, txdata, success, result);
+        if (!success) {
+            AsyncTask(ENamedThreads::GameThread, [Out, result]() {
+                Out.ExecuteIfBound(FCronosTransactionReceiptRaw(), result);
+            });
+            return;
         }
 
-        AsyncTask(ENamedThreads::GameThread, [Out, txresult, result]() {
-            Out.ExecuteIfBound(txresult, result);
-        });
+        // the receipt watcher waits for the receipt, no worker is parked
+        std::string noncefrom = TCHAR_TO_UTF8(*fromaddress);
+        watcher->send(
+            signedtx,
+            [Out, noncemanager, noncefrom, chainid](FString txhash,
+                                                    FString error) {
+                if (!error.IsEmpty()) {
+                    // rejected (nonce too low/high), fetch it again
+                    noncemanager->resync(noncefrom, chainid);
+                    Out.ExecuteIfBound(
+                        FCronosTransactionReceiptRaw(),
+                        FString::Printf(
+                            TEXT("CronosPlayUnreal SendAmount Error: %s"),
+                            *error));
+                }
+            },
+            [Out, noncemanager, noncefrom, chainid, estimator, readcache,
+             fromaddress, toaddress,
+             txdata](FCronosTransactionReceiptRaw receipt, FString error) {
+                if (!error.IsEmpty()) {
+                    // dropped, fetch the nonce again
+                    noncemanager->resync(noncefrom, chainid);
+                    error = FString::Printf(
+                        TEXT("CronosPlayUnreal SendAmount Error: %s"), *error);
+                } else {
+                    estimator->learn(toaddress, txdata,
+                                     FCString::Strtoui64(*receipt.GasUsed,
+                                                         NULL, 10),
+                                     receipt.Status == TEXT("1"));
+                    readcache->invalidate(fromaddress);
+                    readcache->invalidate(toaddress);
+                }
+                Out.ExecuteIfBound(receipt, error);
+            });
     });
 }
 
@@ -983,6 +1715,8 @@ TArray<uint8> ADefiWalletCoreActor::SignEthAmount(
     FString gasLimit, FString gasPrice, TArray<uint8> txdata, bool &success,
     FString &output_message) {
     TArray<uint8> output;
+    std::string noncefrom; // set once a local nonce is acquired
+    uint64_t nonce1 = 0;
     try {
         if (NULL == _coreWallet) {
             success = false;
@@ -995,10 +1729,10 @@ TArray<uint8> ADefiWalletCoreActor::SignEthAmount(
             return output;
         }
 
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc); /* 8545 port */
+        CronosEndpointCall rpc = callCronosRpc();
 
-        rust::cxxbridge1::String myfromaddress =
-            _coreWallet->get_eth_address(walletIndex);
+        std::string myfromaddress =
+            TCHAR_TO_UTF8(*getWalletAddress(CoinType::Ethereum, walletIndex));
         if (!isSameAddress(myfromaddress.c_str(),
                            TCHAR_TO_UTF8(*fromaddress))) {
             success = false;
@@ -1007,25 +1741,35 @@ TArray<uint8> ADefiWalletCoreActor::SignEthAmount(
         }
 
         rust::cxxbridge1::String mytoaddress = TCHAR_TO_UTF8(*toaddress);
-        rust::cxxbridge1::String nonce1 =
-            get_eth_nonce(myfromaddress.c_str(), mycronosrpc);
-        char hdpath[100];
-        snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d", EthCoinType,
-                 walletIndex);
-        rust::cxxbridge1::Box<PrivateKey> privatekey =
-            _coreWallet->get_key(hdpath);
+        // before the nonce is taken, the oracle may throw
+        std::string mygasprice =
+            TCHAR_TO_UTF8(*getGasOracle()->resolve(gasPrice));
+        std::string mygaslimit = TCHAR_TO_UTF8(*gasLimit);
+        if (CronosGasEstimator::isAuto(gasLimit)) {
+            // amount in wei, as estimated by eth_estimateGas
+            FString value = CronosAbi::toQuantity(UTF8_TO_TCHAR(
+                parse_ether(TCHAR_TO_UTF8(*amount)).to_string().c_str()));
+            mygaslimit = TCHAR_TO_UTF8(*getGasEstimator()->resolve(
+                gasLimit, fromaddress, toaddress, value, txdata));
+        }
+        nonce1 = _nonceManager->acquire(myfromaddress.c_str(), rpc,
+                                        myCronosChainID);
+        noncefrom = myfromaddress.c_str();
+        PrivateKeyCache::Handle privatekey =
+            getPrivateKey(EthCoinType, walletIndex);
         rust::cxxbridge1::Vec<uint8_t> data;
         org::defi_wallet_core::EthTxInfoRaw eth_tx_info = new_eth_tx_info();
         eth_tx_info.to_address = mytoaddress.c_str();
-        eth_tx_info.nonce = nonce1;
-        eth_tx_info.gas_limit = TCHAR_TO_UTF8(*gasLimit);
-        eth_tx_info.gas_price = TCHAR_TO_UTF8(*gasPrice);
+        eth_tx_info.nonce = std::to_string(nonce1);
+        eth_tx_info.gas_limit = mygaslimit;
+        eth_tx_info.gas_price = mygasprice;
 
         eth_tx_info.amount = TCHAR_TO_UTF8(*amount);
         eth_tx_info.amount_unit = org::defi_wallet_core::EthAmount::EthDecimal;
 
         // data
         eth_tx_info.data.clear();
+        eth_tx_info.data.reserve(txdata.Num());
         for (int i = 0; i < txdata.Num(); i++) {
             eth_tx_info.data.push_back(txdata[i]);
         }
@@ -1033,7 +1777,7 @@ TArray<uint8> ADefiWalletCoreActor::SignEthAmount(
 
         // sign
         rust::Vec<::std::uint8_t> signedtx = build_eth_signed_tx(
-            eth_tx_info, (uint64)myCronosChainID, false, *privatekey);
+            eth_tx_info, (uint64)myCronosChainID, false, **privatekey);
 
         int size = signedtx.size();
         output.Init(0, size);
@@ -1042,6 +1786,10 @@ TArray<uint8> ADefiWalletCoreActor::SignEthAmount(
 
         success = true;
     } catch (const std::exception &e) {
+        if (!noncefrom.empty()) {
+            // nothing was signed, the nonce can be handed out again
+            _nonceManager->release(noncefrom, myCronosChainID, nonce1);
+        }
         success = false;
         output_message =
             FString::Printf(TEXT("CronosPlayUnreal SendAmount Error: %s"),
@@ -1051,6 +1799,171 @@ TArray<uint8> ADefiWalletCoreActor::SignEthAmount(
     return output;
 }
 
+void ADefiWalletCoreActor::SignEthAmountAsync(
+    int32 walletIndex, FString fromaddress, FString toaddress, FString amount,
+    FString gasLimit, FString gasPrice, TArray<uint8> txdata,
+    FWalletQueryBytesDelegate Out) {
+    runQueryAsync<TArray<uint8>>(
+        Out, [=](TArray<uint8> &output, bool &success,
+                 FString &output_message) {
+            output = SignEthAmount(walletIndex, fromaddress, toaddress, amount,
+                                   gasLimit, gasPrice, txdata, success,
+                                   output_message);
+        });
+}
+
+void ADefiWalletCoreActor::SignEthAmounts(const TArray<FCronosEthTxItem> &txs,
+                                          FCronosSignedEthTxs &output,
+                                          bool &success,
+                                          FString &output_message) {
+    output = FCronosSignedEthTxs();
+    // sender address and key, first nonce and count per wallet index
+    struct Sender {
+        std::string address;
+        PrivateKeyCache::Handle privatekey;
+        uint64_t firstnonce = 0;
+        uint64_t count = 0;
+        bool acquired = false;
+    };
+    TMap<int32, Sender> senders;
+    try {
+        if (NULL == _coreWallet) {
+            success = false;
+            output_message = TEXT("Invalid Wallet");
+            return;
+        }
+
+        // everything that may block or throw runs before nonces are taken
+        CronosEndpointCall rpc = callCronosRpc();
+        TMap<FString, std::string> gasprices;
+        std::vector<std::string> gaslimits(txs.Num());
+        for (int32 i = 0; i < txs.Num(); i++) {
+            const FCronosEthTxItem &tx = txs[i];
+            if (tx.WalletIndex < 0) {
+                throw std::runtime_error("Wallet Index is invalid");
+            }
+            Sender &sender = senders.FindOrAdd(tx.WalletIndex);
+            if (sender.count++ == 0) {
+                sender.address = TCHAR_TO_UTF8(
+                    *getWalletAddress(CoinType::Ethereum, tx.WalletIndex));
+                sender.privatekey = getPrivateKey(EthCoinType, tx.WalletIndex);
+            }
+            if (!gasprices.Contains(tx.GasPrice)) {
+                FString gasprice = getGasOracle()->resolve(tx.GasPrice);
+                gasprices.Add(tx.GasPrice, TCHAR_TO_UTF8(*gasprice));
+            }
+            gaslimits[i] = TCHAR_TO_UTF8(*tx.GasLimit);
+            if (CronosGasEstimator::isAuto(tx.GasLimit)) {
+                rust::cxxbridge1::String wei =
+                    parse_ether(TCHAR_TO_UTF8(*tx.Amount)).to_string();
+                FString value =
+                    CronosAbi::toQuantity(UTF8_TO_TCHAR(wei.c_str()));
+                gaslimits[i] = TCHAR_TO_UTF8(*getGasEstimator()->resolve(
+                    tx.GasLimit, UTF8_TO_TCHAR(sender.address.c_str()),
+                    tx.ToAddress, value, tx.TxData));
+            }
+        }
+
+        // consecutive nonces per sender, in the order of txs
+        for (TPair<int32, Sender> &sender : senders) {
+            sender.Value.firstnonce =
+                _nonceManager->acquire(sender.Value.address, rpc,
+                                       myCronosChainID, sender.Value.count);
+            sender.Value.acquired = true;
+        }
+        std::vector<uint64_t> nonces(txs.Num());
+        TMap<int32, uint64_t> nextnonces;
+        for (int32 i = 0; i < txs.Num(); i++) {
+            uint64_t &next = nextnonces.FindOrAdd(
+                txs[i].WalletIndex, senders[txs[i].WalletIndex].firstnonce);
+            nonces[i] = next++;
+        }
+
+        std::vector<rust::cxxbridge1::Vec<uint8_t>> signedtxs(txs.Num());
+        TArray<FString> errors;
+        errors.SetNum(txs.Num());
+        uint64 chainid = (uint64)myCronosChainID;
+        ParallelFor(txs.Num(), [&](int32 i) {
+            try {
+                const FCronosEthTxItem &tx = txs[i];
+                EthTxInfoRaw eth_tx_info = new_eth_tx_info();
+                eth_tx_info.to_address = TCHAR_TO_UTF8(*tx.ToAddress);
+                eth_tx_info.nonce = std::to_string(nonces[i]);
+                eth_tx_info.gas_limit = gaslimits[i];
+                eth_tx_info.gas_price = gasprices[tx.GasPrice];
+                eth_tx_info.amount = TCHAR_TO_UTF8(*tx.Amount);
+                eth_tx_info.amount_unit = EthAmount::EthDecimal;
+                eth_tx_info.data.reserve(tx.TxData.Num());
+                for (uint8 byte : tx.TxData) {
+                    eth_tx_info.data.push_back(byte);
+                }
+                signedtxs[i] = build_eth_signed_tx(
+                    eth_tx_info, chainid, false,
+                    **senders[tx.WalletIndex].privatekey);
+            } catch (const std::exception &e) {
+                errors[i] = FString::Printf(TEXT("tx %d %s"), i,
+                                            UTF8_TO_TCHAR(e.what()));
+            }
+        });
+        for (const FString &error : errors) {
+            if (!error.IsEmpty()) {
+                throw std::runtime_error(TCHAR_TO_UTF8(*error));
+            }
+        }
+
+        output.Offsets.SetNum(txs.Num() + 1);
+        int32 size = 0;
+        for (int32 i = 0; i < txs.Num(); i++) {
+            output.Offsets[i] = size;
+            size += (int32)signedtxs[i].size();
+        }
+        output.Offsets[txs.Num()] = size;
+        output.Data.SetNumUninitialized(size);
+        for (int32 i = 0; i < txs.Num(); i++) {
+            FMemory::Memcpy(output.Data.GetData() + output.Offsets[i],
+                            signedtxs[i].data(), signedtxs[i].size());
+        }
+        success = true;
+        output_message = TEXT("");
+    } catch (const std::exception &e) {
+        for (const TPair<int32, Sender> &sender : senders) {
+            if (sender.Value.acquired) {
+                // nothing is returned, the nonces can be handed out again
+                _nonceManager->release(sender.Value.address, myCronosChainID,
+                                       sender.Value.firstnonce,
+                                       sender.Value.count);
+            }
+        }
+        output = FCronosSignedEthTxs();
+        success = false;
+        output_message =
+            FString::Printf(TEXT("CronosPlayUnreal SignEthAmounts Error: %s"),
+                            UTF8_TO_TCHAR(e.what()));
+    }
+}
+
+void ADefiWalletCoreActor::SignEthAmountsAsync(
+    const TArray<FCronosEthTxItem> &txs, FCronosSignedEthTxsDelegate Out) {
+    runQueryAsync<FCronosSignedEthTxs>(
+        Out, [=](FCronosSignedEthTxs &output, bool &success,
+                 FString &output_message) {
+            SignEthAmounts(txs, output, success, output_message);
+        });
+}
+
+TArray<uint8>
+ADefiWalletCoreActor::GetSignedEthTx(const FCronosSignedEthTxs &txs,
+                                     int32 index) {
+    TArray<uint8> output;
+    if (index >= 0 && index + 1 < txs.Offsets.Num() &&
+        txs.Offsets[index] <= txs.Offsets[index + 1] &&
+        txs.Offsets[index + 1] <= txs.Data.Num()) {
+        output.Append(txs.Data.GetData() + txs.Offsets[index],
+                      txs.Offsets[index + 1] - txs.Offsets[index]);
+    }
+    return output;
+}
+
 void ADefiWalletCoreActor::SignLogin(int32 walletIndex, FString document,
                                      TArray<uint8> &signatureOutput,
                                      bool &success, FString &output_message) {
@@ -1069,17 +1982,13 @@ void ADefiWalletCoreActor::SignLogin(int32 walletIndex, FString document,
         rust::cxxbridge1::Box<CppLoginInfo> logininfo =
             new_logininfo(TCHAR_TO_UTF8(*document));
 
-        char hdpath[100];
-        int coin_type = 60; // eth cointype
-        snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d", coin_type,
-                 walletIndex);
-        rust::cxxbridge1::Box<PrivateKey> privatekey =
-            _coreWallet->get_key(hdpath);
+        PrivateKeyCache::Handle privatekey =
+            getPrivateKey(EthCoinType, walletIndex);
 
         rust::cxxbridge1::String default_address =
             _coreWallet->get_address(CoinType::CronosMainnet, walletIndex);
         rust::cxxbridge1::Vec<uint8_t> signature =
-            logininfo->sign_logininfo(*privatekey);
+            logininfo->sign_logininfo(**privatekey);
         assert(signature.size() == 65);
         // copy
         signatureOutput.Init(0, signature.size());
@@ -1149,14 +2058,26 @@ void ADefiWalletCoreActor::Erc20Balance(FString contractAddress,
                                         FString &balance, bool &success,
                                         FString &output_message) {
     try {
+        TSharedRef<ReadCache, ESPMode::ThreadSafe> readcache = getReadCache();
+        FString key = ReadCache::readKey(myCronosChainID, TEXT("Erc20Balance"),
+                                         contractAddress, accountAddress);
+        if (readcache->get(key, balance)) {
+            success = true;
+            return;
+        }
+        uint64 generation = readcache->begin();
         std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
         std::string myaccountaddress = TCHAR_TO_UTF8(*accountAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
 
         Erc20 erc20 =
             new_erc20(mycontractaddress, mycronosrpc, myCronosChainID).legacy();
-        U256 erc20_balance = erc20.balance_of(myaccountaddress);
+        U256 erc20_balance = rpc.run([&]() {
+            return erc20.balance_of(myaccountaddress);
+        });
         balance = UTF8_TO_TCHAR(erc20_balance.to_string().c_str());
+        readcache->put(key, balance, generation);
         success = true;
 
     } catch (const std::exception &e) {
@@ -1167,19 +2088,55 @@ void ADefiWalletCoreActor::Erc20Balance(FString contractAddress,
     }
 }
 
+void ADefiWalletCoreActor::Erc20BalanceAsync(FString contractAddress,
+                                             FString accountAddress,
+                                             FWalletQueryStringDelegate Out) {
+    TSharedRef<ReadCache, ESPMode::ThreadSafe> readcache = getReadCache();
+    FString key = ReadCache::readKey(myCronosChainID, TEXT("Erc20Balance"),
+                                     contractAddress, accountAddress);
+    if (deliverCached(*readcache, key, Out)) {
+        return;
+    }
+    uint64 generation = readcache->begin();
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc20BalanceAsync"), contractAddress,
+        [=]() {
+            return CronosAbi::BalanceOf +
+                   CronosAbi::encodeAddress(accountAddress);
+        },
+        [readcache, key, generation](const FString &data) {
+            FString value = CronosAbi::decodeUint256(data);
+            readcache->put(key, value, generation);
+            return value;
+        },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc721Balance(FString contractAddress,
                                          FString accountAddress,
                                          FString &balance, bool &success,
                                          FString &output_message) {
     try {
+        TSharedRef<ReadCache, ESPMode::ThreadSafe> readcache = getReadCache();
+        FString key = ReadCache::readKey(myCronosChainID, TEXT("Erc721Balance"),
+                                         contractAddress, accountAddress);
+        if (readcache->get(key, balance)) {
+            success = true;
+            return;
+        }
+        uint64 generation = readcache->begin();
         std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
         std::string myaccountaddress = TCHAR_TO_UTF8(*accountAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         Erc721 erc721 =
             new_erc721(mycontractaddress, mycronosrpc, myCronosChainID)
                 .legacy();
-        U256 erc721_balance = erc721.balance_of(myaccountaddress);
+        U256 erc721_balance = rpc.run([&]() {
+            return erc721.balance_of(myaccountaddress);
+        });
         balance = UTF8_TO_TCHAR(erc721_balance.to_string().c_str());
+        readcache->put(key, balance, generation);
         success = true;
 
     } catch (const std::exception &e) {
@@ -1190,21 +2147,58 @@ void ADefiWalletCoreActor::Erc721Balance(FString contractAddress,
     }
 }
 
+void ADefiWalletCoreActor::Erc721BalanceAsync(FString contractAddress,
+                                              FString accountAddress,
+                                              FWalletQueryStringDelegate Out) {
+    TSharedRef<ReadCache, ESPMode::ThreadSafe> readcache = getReadCache();
+    FString key = ReadCache::readKey(myCronosChainID, TEXT("Erc721Balance"),
+                                     contractAddress, accountAddress);
+    if (deliverCached(*readcache, key, Out)) {
+        return;
+    }
+    uint64 generation = readcache->begin();
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc721BalanceAsync"), contractAddress,
+        [=]() {
+            return CronosAbi::BalanceOf +
+                   CronosAbi::encodeAddress(accountAddress);
+        },
+        [readcache, key, generation](const FString &data) {
+            FString value = CronosAbi::decodeUint256(data);
+            readcache->put(key, value, generation);
+            return value;
+        },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc1155Balance(FString contractAddress,
                                           FString accountAddress,
                                           FString tokenID, FString &balance,
                                           bool &success,
                                           FString &output_message) {
     try {
+        TSharedRef<ReadCache, ESPMode::ThreadSafe> readcache = getReadCache();
+        FString key =
+            ReadCache::readKey(myCronosChainID, TEXT("Erc1155Balance"),
+                               contractAddress, accountAddress + "," + tokenID);
+        if (readcache->get(key, balance)) {
+            success = true;
+            return;
+        }
+        uint64 generation = readcache->begin();
         std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
         std::string myaccountaddress = TCHAR_TO_UTF8(*accountAddress);
         std::string mytokenid = TCHAR_TO_UTF8(*tokenID);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         Erc1155 erc1155 =
             new_erc1155(mycontractaddress, mycronosrpc, myCronosChainID)
                 .legacy();
-        U256 erc1155_balance = erc1155.balance_of(myaccountaddress, mytokenid);
+        U256 erc1155_balance = rpc.run([&]() {
+            return erc1155.balance_of(myaccountaddress, mytokenid);
+        });
         balance = UTF8_TO_TCHAR(erc1155_balance.to_string().c_str());
+        readcache->put(key, balance, generation);
         success = true;
 
     } catch (const std::exception &e) {
@@ -1215,33 +2209,118 @@ void ADefiWalletCoreActor::Erc1155Balance(FString contractAddress,
     }
 }
 
+void ADefiWalletCoreActor::Erc1155BalanceAsync(FString contractAddress,
+                                               FString accountAddress,
+                                               FString tokenID,
+                                               FWalletQueryStringDelegate Out) {
+    TSharedRef<ReadCache, ESPMode::ThreadSafe> readcache = getReadCache();
+    FString key = ReadCache::readKey(myCronosChainID, TEXT("Erc1155Balance"),
+                                     contractAddress,
+                                     accountAddress + "," + tokenID);
+    if (deliverCached(*readcache, key, Out)) {
+        return;
+    }
+    uint64 generation = readcache->begin();
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc1155BalanceAsync"), contractAddress,
+        [=]() {
+            return CronosAbi::Erc1155BalanceOf +
+                   CronosAbi::encodeAddress(accountAddress) +
+                   CronosAbi::encodeUint256(tokenID);
+        },
+        [readcache, key, generation](const FString &data) {
+            FString value = CronosAbi::decodeUint256(data);
+            readcache->put(key, value, generation);
+            return value;
+        },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc1155BalanceOfBatch(
     FString contractAddress, TArray<FString> accountAddresses,
     TArray<FString> tokenIDs, TArray<FString> &balanceofbatch, bool &success,
     FString &output_message) {
     try {
-        std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
-
-        rust::Vec<rust::String> myaccountaddresses;
-        for (int i = 0; i < accountAddresses.Num(); i++) {
-            myaccountaddresses.push_back(TCHAR_TO_UTF8(*accountAddresses[i]));
+        if (accountAddresses.Num() != tokenIDs.Num()) {
+            throw std::runtime_error(
+                "accountAddresses and tokenIDs differ in length");
         }
-
-        rust::Vec<rust::String> mytokenids;
-        for (int i = 0; i < tokenIDs.Num(); i++) {
-            mytokenids.push_back(TCHAR_TO_UTF8(*tokenIDs[i]));
+        std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
+        int32 total = accountAddresses.Num();
+        int32 chunksize = FMath::Max(1, myErc1155BatchChunkSize);
+        int32 chunks = (total + chunksize - 1) / chunksize;
+
+        // one balance_of_batch per chunk on worker threads, errors are
+        // rethrown on the calling thread
+        TArray<FString> balances;
+        balances.SetNum(total);
+        TArray<FString> errors;
+        errors.SetNum(chunks);
+        struct Range {
+            int32 start;
+            int32 count;
+            int32 attempt;
+        };
+        ParallelFor(chunks, [&](int32 chunk) {
+            int32 chunkstart = chunk * chunksize;
+            TArray<Range> ranges;
+            ranges.Add({chunkstart, FMath::Min(chunksize, total - chunkstart),
+                        1});
+            while (ranges.Num() > 0) {
+                Range range = ranges.Pop();
+                rust::Vec<rust::String> myaccountaddresses;
+                rust::Vec<rust::String> mytokenids;
+                for (int32 i = range.start; i < range.start + range.count;
+                     i++) {
+                    myaccountaddresses.push_back(
+                        TCHAR_TO_UTF8(*accountAddresses[i]));
+                    mytokenids.push_back(TCHAR_TO_UTF8(*tokenIDs[i]));
+                }
+                try {
+                    Erc1155 erc1155 =
+                        new_erc1155(mycontractaddress, mycronosrpc,
+                                    myCronosChainID)
+                            .legacy();
+                    ::rust::Vec<::rust::String> erc1155_balances =
+                        rpc.run([&]() {
+                            return erc1155.balance_of_batch(myaccountaddresses,
+                                                            mytokenids);
+                        });
+                    if ((int32)erc1155_balances.size() != range.count) {
+                        throw std::runtime_error(
+                            "balanceOfBatch result count mismatch");
+                    }
+                    for (int32 i = 0; i < range.count; i++) {
+                        balances[range.start + i] =
+                            UTF8_TO_TCHAR(erc1155_balances[i].c_str());
+                    }
+                } catch (const std::exception &e) {
+                    if (range.attempt >= CronosErc1155Batch::MaxAttempts) {
+                        errors[chunk] = UTF8_TO_TCHAR(e.what());
+                        return;
+                    }
+                    if (range.count > 1) {
+                        // smaller calls get under a calldata or gas cap
+                        int32 half = range.count / 2;
+                        ranges.Add({range.start + half, range.count - half,
+                                    range.attempt + 1});
+                        ranges.Add({range.start, half, range.attempt + 1});
+                    } else {
+                        ranges.Add(
+                            {range.start, range.count, range.attempt + 1});
+                    }
+                }
+            }
+        });
+        for (const FString &error : errors) {
+            if (!error.IsEmpty()) {
+                throw std::runtime_error(TCHAR_TO_UTF8(*error));
+            }
         }
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
-        Erc1155 erc1155 =
-            new_erc1155(mycontractaddress, mycronosrpc, myCronosChainID)
-                .legacy();
-        ::rust::Vec<::rust::String> erc1155_balances =
-            erc1155.balance_of_batch(myaccountaddresses, mytokenids);
 
-        balanceofbatch.Empty();
-        for (int i = 0; i < erc1155_balances.size(); i++) {
-            balanceofbatch.Add(UTF8_TO_TCHAR(erc1155_balances[i].c_str()));
-        }
+        balanceofbatch = balances;
         success = true;
 
     } catch (const std::exception &e) {
@@ -1252,14 +2331,46 @@ void ADefiWalletCoreActor::Erc1155BalanceOfBatch(
     }
 }
 
+void ADefiWalletCoreActor::Erc1155BalanceOfBatchAsync(
+    FString contractAddress, TArray<FString> accountAddresses,
+    TArray<FString> tokenIDs, FWalletQueryStringArrayDelegate Out) {
+    try {
+        TSharedRef<CronosErc1155Batch, ESPMode::ThreadSafe> batch =
+            MakeShared<CronosErc1155Batch, ESPMode::ThreadSafe>(
+                getRpcBatcher(), contractAddress, accountAddresses, tokenIDs,
+                myErc1155BatchChunkSize);
+        batch->start(
+            [Out](const TArray<FString> &balances, const FString &error) {
+                FString result;
+                if (!error.IsEmpty()) {
+                    result = FString::Printf(
+                        TEXT("CronosPlayUnreal Erc1155BalanceOfBatchAsync "
+                             "Error: %s"),
+                        *error);
+                }
+                Out.ExecuteIfBound(balances, result);
+            });
+    } catch (const std::exception &e) {
+        FString result = FString::Printf(
+            TEXT("CronosPlayUnreal Erc1155BalanceOfBatchAsync Error: %s"),
+            UTF8_TO_TCHAR(e.what()));
+        AsyncTask(ENamedThreads::GameThread, [Out, result]() {
+            Out.ExecuteIfBound(TArray<FString>(), result);
+        });
+    }
+}
+
 void ADefiWalletCoreActor::Erc721Name(FString contractAddress, FString &name,
                                       bool &success, FString &output_message) {
     try {
         std::string myaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         ::org::defi_wallet_core::Erc721 erc721 =
             new_erc721(myaddress, mycronosrpc, myCronosChainID).legacy();
-        rust::cxxbridge1::String erc721name = erc721.name();
+        rust::cxxbridge1::String erc721name = rpc.run([&]() {
+            return erc721.name();
+        });
         name = UTF8_TO_TCHAR(erc721name.c_str());
         success = true;
 
@@ -1271,15 +2382,27 @@ void ADefiWalletCoreActor::Erc721Name(FString contractAddress, FString &name,
     }
 }
 
+void ADefiWalletCoreActor::Erc721NameAsync(FString contractAddress,
+                                           FWalletQueryStringDelegate Out) {
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc721NameAsync"), contractAddress,
+        []() { return FString(CronosAbi::Name); },
+        [](const FString &data) { return CronosAbi::decodeString(data); },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc721Symbol(FString contractAddress,
                                         FString &symbol, bool &success,
                                         FString &output_message) {
     try {
         std::string myaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         ::org::defi_wallet_core::Erc721 erc721 =
             new_erc721(myaddress, mycronosrpc, myCronosChainID).legacy();
-        rust::cxxbridge1::String erc721symbol = erc721.symbol();
+        rust::cxxbridge1::String erc721symbol = rpc.run([&]() {
+            return erc721.symbol();
+        });
         symbol = UTF8_TO_TCHAR(erc721symbol.c_str());
         success = true;
     } catch (const std::exception &e) {
@@ -1290,16 +2413,28 @@ void ADefiWalletCoreActor::Erc721Symbol(FString contractAddress,
     }
 }
 
+void ADefiWalletCoreActor::Erc721SymbolAsync(FString contractAddress,
+                                             FWalletQueryStringDelegate Out) {
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc721SymbolAsync"), contractAddress,
+        []() { return FString(CronosAbi::Symbol); },
+        [](const FString &data) { return CronosAbi::decodeString(data); },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc721Uri(FString contractAddress, FString tokenID,
                                      FString &uri, bool &success,
                                      FString &output_message) {
     try {
         std::string myaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         ::org::defi_wallet_core::Erc721 erc721 =
             new_erc721(myaddress, mycronosrpc, myCronosChainID).legacy();
         std::string mytokenid = TCHAR_TO_UTF8(*tokenID); /* bug fix*/
-        rust::cxxbridge1::String erc721uri = erc721.token_uri(mytokenid);
+        rust::cxxbridge1::String erc721uri = rpc.run([&]() {
+            return erc721.token_uri(mytokenid);
+        });
         uri = UTF8_TO_TCHAR(erc721uri.c_str());
         success = true;
 
@@ -1311,18 +2446,33 @@ void ADefiWalletCoreActor::Erc721Uri(FString contractAddress, FString tokenID,
     }
 }
 
+void ADefiWalletCoreActor::Erc721UriAsync(FString contractAddress,
+                                          FString tokenID,
+                                          FWalletQueryStringDelegate Out) {
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc721UriAsync"), contractAddress,
+        [=]() {
+            return CronosAbi::TokenURI +
+                   CronosAbi::encodeUint256(tokenID);
+        },
+        [](const FString &data) { return CronosAbi::decodeString(data); },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc721GetApproved(FString contractAddress,
                                              FString tokenID, FString &result,
                                              bool &success,
                                              FString &output_message) {
     try {
         std::string myaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         ::org::defi_wallet_core::Erc721 erc721 =
             new_erc721(myaddress, mycronosrpc, myCronosChainID).legacy();
         std::string mytokenid = TCHAR_TO_UTF8(*tokenID); /* bug fix*/
-        rust::cxxbridge1::String erc721getapproved =
-            erc721.get_approved(mytokenid);
+        rust::cxxbridge1::String erc721getapproved = rpc.run([&]() {
+            return erc721.get_approved(mytokenid);
+        });
         result = UTF8_TO_TCHAR(erc721getapproved.c_str());
         success = true;
 
@@ -1334,6 +2484,18 @@ void ADefiWalletCoreActor::Erc721GetApproved(FString contractAddress,
     }
 }
 
+void ADefiWalletCoreActor::Erc721GetApprovedAsync(
+    FString contractAddress, FString tokenID, FWalletQueryStringDelegate Out) {
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc721GetApprovedAsync"), contractAddress,
+        [=]() {
+            return CronosAbi::GetApproved +
+                   CronosAbi::encodeUint256(tokenID);
+        },
+        [](const FString &data) { return CronosAbi::decodeAddress(data); },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc721IsApprovedForAll(FString contractAddress,
                                                   FString erc721owner,
                                                   FString erc721approvedaddress,
@@ -1341,12 +2503,15 @@ void ADefiWalletCoreActor::Erc721IsApprovedForAll(FString contractAddress,
                                                   FString &output_message) {
     try {
         std::string myaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         ::org::defi_wallet_core::Erc721 erc721 =
             new_erc721(myaddress, mycronosrpc, myCronosChainID).legacy();
         std::string myowner = TCHAR_TO_UTF8(*erc721owner);
         std::string myapprovedaddress = TCHAR_TO_UTF8(*erc721approvedaddress);
-        result = erc721.is_approved_for_all(myowner, myapprovedaddress);
+        result = rpc.run([&]() {
+            return erc721.is_approved_for_all(myowner, myapprovedaddress);
+        });
         success = true;
 
     } catch (const std::exception &e) {
@@ -1357,16 +2522,33 @@ void ADefiWalletCoreActor::Erc721IsApprovedForAll(FString contractAddress,
     }
 }
 
+void ADefiWalletCoreActor::Erc721IsApprovedForAllAsync(
+    FString contractAddress, FString erc721owner, FString erc721approvedaddress,
+    FWalletQueryBoolDelegate Out) {
+    ethCallBatched<bool>(
+        getRpcBatcher(), TEXT("Erc721IsApprovedForAllAsync"), contractAddress,
+        [=]() {
+            return CronosAbi::IsApprovedForAll +
+                   CronosAbi::encodeAddress(erc721owner) +
+                   CronosAbi::encodeAddress(erc721approvedaddress);
+        },
+        [](const FString &data) { return CronosAbi::decodeBool(data); },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc1155Uri(FString contractAddress, FString tokenID,
                                       FString &uri, bool &success,
                                       FString &output_message) {
     try {
         std::string myaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         ::org::defi_wallet_core::Erc1155 erc1155 =
             new_erc1155(myaddress, mycronosrpc, myCronosChainID).legacy();
         std::string mytokenid = TCHAR_TO_UTF8(*tokenID);
-        rust::cxxbridge1::String erc1155uri = erc1155.uri(mytokenid);
+        rust::cxxbridge1::String erc1155uri = rpc.run([&]() {
+            return erc1155.uri(mytokenid);
+        });
         uri = UTF8_TO_TCHAR(erc1155uri.c_str());
         success = true;
 
@@ -1378,18 +2560,31 @@ void ADefiWalletCoreActor::Erc1155Uri(FString contractAddress, FString tokenID,
     }
 }
 
+void ADefiWalletCoreActor::Erc1155UriAsync(FString contractAddress,
+                                           FString tokenID,
+                                           FWalletQueryStringDelegate Out) {
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc1155UriAsync"), contractAddress,
+        [=]() { return CronosAbi::Uri + CronosAbi::encodeUint256(tokenID); },
+        [](const FString &data) { return CronosAbi::decodeString(data); },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc1155IsApprovedForAll(
     FString contractAddress, FString erc1155owner,
     FString erc1155approvedaddress, bool &result, bool &success,
     FString &output_message) {
     try {
         std::string myaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         ::org::defi_wallet_core::Erc1155 erc1155 =
             new_erc1155(myaddress, mycronosrpc, myCronosChainID).legacy();
         std::string myowner = TCHAR_TO_UTF8(*erc1155owner);
         std::string myapprovedaddress = TCHAR_TO_UTF8(*erc1155approvedaddress);
-        result = erc1155.is_approved_for_all(myowner, myapprovedaddress);
+        result = rpc.run([&]() {
+            return erc1155.is_approved_for_all(myowner, myapprovedaddress);
+        });
         success = true;
 
     } catch (const std::exception &e) {
@@ -1400,19 +2595,45 @@ void ADefiWalletCoreActor::Erc1155IsApprovedForAll(
     }
 }
 
+void ADefiWalletCoreActor::Erc1155IsApprovedForAllAsync(
+    FString contractAddress, FString erc1155owner,
+    FString erc1155approvedaddress, FWalletQueryBoolDelegate Out) {
+    ethCallBatched<bool>(
+        getRpcBatcher(), TEXT("Erc1155IsApprovedForAllAsync"), contractAddress,
+        [=]() {
+            return CronosAbi::IsApprovedForAll +
+                   CronosAbi::encodeAddress(erc1155owner) +
+                   CronosAbi::encodeAddress(erc1155approvedaddress);
+        },
+        [](const FString &data) { return CronosAbi::decodeBool(data); },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc721Owner(FString contractAddress, FString tokenID,
                                        FString &ercowner, bool &success,
                                        FString &output_message) {
     try {
+        TSharedRef<ReadCache, ESPMode::ThreadSafe> readcache = getReadCache();
+        FString key = ReadCache::readKey(myCronosChainID, TEXT("Erc721Owner"),
+                                         contractAddress, tokenID);
+        if (readcache->get(key, ercowner)) {
+            success = true;
+            return;
+        }
+        uint64 generation = readcache->begin();
         std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         std::string mytokenid = TCHAR_TO_UTF8(*tokenID);
         Erc721 erc721 =
             new_erc721(mycontractaddress, mycronosrpc, myCronosChainID)
                 .legacy();
-        rust::cxxbridge1::String erc721owner = erc721.owner_of(mytokenid);
+        rust::cxxbridge1::String erc721owner = rpc.run([&]() {
+            return erc721.owner_of(mytokenid);
+        });
 
         ercowner = UTF8_TO_TCHAR(erc721owner.c_str());
+        readcache->put(key, ercowner, generation);
         success = true;
 
     } catch (const std::exception &e) {
@@ -1423,18 +2644,44 @@ void ADefiWalletCoreActor::Erc721Owner(FString contractAddress, FString tokenID,
     }
 }
 
+void ADefiWalletCoreActor::Erc721OwnerAsync(FString contractAddress,
+                                            FString tokenID,
+                                            FWalletQueryStringDelegate Out) {
+    TSharedRef<ReadCache, ESPMode::ThreadSafe> readcache = getReadCache();
+    FString key = ReadCache::readKey(myCronosChainID, TEXT("Erc721Owner"),
+                                     contractAddress, tokenID);
+    if (deliverCached(*readcache, key, Out)) {
+        return;
+    }
+    uint64 generation = readcache->begin();
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc721OwnerAsync"), contractAddress,
+        [=]() {
+            return CronosAbi::OwnerOf +
+                   CronosAbi::encodeUint256(tokenID);
+        },
+        [readcache, key, generation](const FString &data) {
+            FString value = CronosAbi::decodeAddress(data);
+            readcache->put(key, value, generation);
+            return value;
+        },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc721TotalSupply(FString contractAddress,
                                              FString &totalsupply,
                                              bool &success,
                                              FString &output_message) {
     try {
         std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         Erc721 erc721 =
             new_erc721(mycontractaddress, mycronosrpc, myCronosChainID)
                 .legacy();
-        rust::cxxbridge1::String erc721totalsupply =
-            erc721.total_supply().to_string();
+        rust::cxxbridge1::String erc721totalsupply = rpc.run([&]() {
+            return erc721.total_supply().to_string();
+        });
 
         totalsupply = UTF8_TO_TCHAR(erc721totalsupply.c_str());
         success = true;
@@ -1447,18 +2694,30 @@ void ADefiWalletCoreActor::Erc721TotalSupply(FString contractAddress,
     }
 }
 
+void ADefiWalletCoreActor::Erc721TotalSupplyAsync(
+    FString contractAddress, FWalletQueryStringDelegate Out) {
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc721TotalSupplyAsync"), contractAddress,
+        []() { return FString(CronosAbi::TotalSupply); },
+        [](const FString &data) { return CronosAbi::decodeUint256(data); },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc721TokenByIndex(FString contractAddress,
                                               FString erc721index,
                                               FString &token, bool &success,
                                               FString &output_message) {
     try {
         std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         std::string myindex = TCHAR_TO_UTF8(*erc721index);
         Erc721 erc721 =
             new_erc721(mycontractaddress, mycronosrpc, myCronosChainID)
                 .legacy();
-        rust::cxxbridge1::String erc721token = erc721.token_by_index(myindex);
+        rust::cxxbridge1::String erc721token = rpc.run([&]() {
+            return erc721.token_by_index(myindex);
+        });
 
         token = UTF8_TO_TCHAR(erc721token.c_str());
         success = true;
@@ -1471,19 +2730,34 @@ void ADefiWalletCoreActor::Erc721TokenByIndex(FString contractAddress,
     }
 }
 
+void ADefiWalletCoreActor::Erc721TokenByIndexAsync(
+    FString contractAddress, FString erc721index,
+    FWalletQueryStringDelegate Out) {
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc721TokenByIndexAsync"), contractAddress,
+        [=]() {
+            return CronosAbi::TokenByIndex +
+                   CronosAbi::encodeUint256(erc721index);
+        },
+        [](const FString &data) { return CronosAbi::decodeUint256(data); },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc721TokenOwnerByIndex(
     FString contractAddress, FString erc721owner, FString erc721index,
     FString &token, bool &success, FString &output_message) {
     try {
         std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         std::string myowner = TCHAR_TO_UTF8(*erc721owner);
         std::string myindex = TCHAR_TO_UTF8(*erc721index);
         Erc721 erc721 =
             new_erc721(mycontractaddress, mycronosrpc, myCronosChainID)
                 .legacy();
-        rust::cxxbridge1::String erc721token =
-            erc721.token_of_owner_by_index(myowner, myindex);
+        rust::cxxbridge1::String erc721token = rpc.run([&]() {
+            return erc721.token_of_owner_by_index(myowner, myindex);
+        });
 
         token = UTF8_TO_TCHAR(erc721token.c_str());
         success = true;
@@ -1496,15 +2770,80 @@ void ADefiWalletCoreActor::Erc721TokenOwnerByIndex(
     }
 }
 
+void ADefiWalletCoreActor::Erc721TokenOwnerByIndexAsync(
+    FString contractAddress, FString erc721owner, FString erc721index,
+    FWalletQueryStringDelegate Out) {
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc721TokenOwnerByIndexAsync"), contractAddress,
+        [=]() {
+            return CronosAbi::TokenOfOwnerByIndex +
+                   CronosAbi::encodeAddress(erc721owner) +
+                   CronosAbi::encodeUint256(erc721index);
+        },
+        [](const FString &data) { return CronosAbi::decodeUint256(data); },
+        Out);
+}
+
+int64 ADefiWalletCoreActor::EnumerateOwnedTokens(
+    FString contractAddress, FString ownerAddress,
+    FCronosTokenPageDelegate OnPage, FCronosEnumerationDoneDelegate OnDone) {
+    int64 handle = ++_lastEnumeration;
+    try {
+        TSharedRef<CronosTokenEnumerator, ESPMode::ThreadSafe> enumerator =
+            MakeShared<CronosTokenEnumerator, ESPMode::ThreadSafe>(
+                getRpcBatcher(), contractAddress, ownerAddress,
+                getMulticallAddress());
+        enumerator->setPageSize(myEnumerationPageSize);
+        enumerator->setConcurrency(myEnumerationConcurrency);
+        _enumerations.Add(handle, enumerator);
+        // cancelled on Destroyed, so this outlives the callbacks
+        enumerator->start(
+            [handle, OnPage](int64 start, const TArray<FString> &tokenids) {
+                OnPage.ExecuteIfBound(handle, start, tokenids);
+            },
+            [this, handle, OnDone](int64 total, const FString &error) {
+                _enumerations.Remove(handle);
+                FString result;
+                if (!error.IsEmpty()) {
+                    result = FString::Printf(
+                        TEXT("CronosPlayUnreal EnumerateOwnedTokens Error: %s"),
+                        *error);
+                }
+                OnDone.ExecuteIfBound(handle, total, result);
+            });
+    } catch (const std::exception &e) {
+        FString result = FString::Printf(
+            TEXT("CronosPlayUnreal EnumerateOwnedTokens Error: %s"),
+            UTF8_TO_TCHAR(e.what()));
+        AsyncTask(ENamedThreads::GameThread, [handle, OnDone, result]() {
+            OnDone.ExecuteIfBound(handle, 0, result);
+        });
+    }
+    return handle;
+}
+
+void ADefiWalletCoreActor::CancelEnumeration(int64 handle) {
+    TSharedRef<CronosTokenEnumerator, ESPMode::ThreadSafe> *enumerator =
+        _enumerations.Find(handle);
+    if (enumerator == NULL) {
+        return;
+    }
+    (*enumerator)->cancel();
+    _enumerations.Remove(handle);
+}
+
 // erc-20
 void ADefiWalletCoreActor::Erc20Name(FString contractAddress, FString &name,
                                      bool &success, FString &output_message) {
     try {
         std::string myaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         ::org::defi_wallet_core::Erc20 erc20 =
             new_erc20(myaddress, mycronosrpc, myCronosChainID).legacy();
-        rust::cxxbridge1::String erc20name = erc20.name();
+        rust::cxxbridge1::String erc20name = rpc.run([&]() {
+            return erc20.name();
+        });
         name = UTF8_TO_TCHAR(erc20name.c_str());
         success = true;
 
@@ -1516,14 +2855,26 @@ void ADefiWalletCoreActor::Erc20Name(FString contractAddress, FString &name,
     }
 }
 
+void ADefiWalletCoreActor::Erc20NameAsync(FString contractAddress,
+                                          FWalletQueryStringDelegate Out) {
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc20NameAsync"), contractAddress,
+        []() { return FString(CronosAbi::Name); },
+        [](const FString &data) { return CronosAbi::decodeString(data); },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc20Symbol(FString contractAddress, FString &symbol,
                                        bool &success, FString &output_message) {
     try {
         std::string myaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         ::org::defi_wallet_core::Erc20 erc20 =
             new_erc20(myaddress, mycronosrpc, myCronosChainID).legacy();
-        rust::cxxbridge1::String erc20symbol = erc20.symbol();
+        rust::cxxbridge1::String erc20symbol = rpc.run([&]() {
+            return erc20.symbol();
+        });
         symbol = UTF8_TO_TCHAR(erc20symbol.c_str());
         success = true;
 
@@ -1535,15 +2886,27 @@ void ADefiWalletCoreActor::Erc20Symbol(FString contractAddress, FString &symbol,
     }
 }
 
+void ADefiWalletCoreActor::Erc20SymbolAsync(FString contractAddress,
+                                            FWalletQueryStringDelegate Out) {
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc20SymbolAsync"), contractAddress,
+        []() { return FString(CronosAbi::Symbol); },
+        [](const FString &data) { return CronosAbi::decodeString(data); },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc20Decimals(FString contractAddress,
                                          int32 &decimals, bool &success,
                                          FString &output_message) {
     try {
         std::string myaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         ::org::defi_wallet_core::Erc20 erc20 =
             new_erc20(myaddress, mycronosrpc, myCronosChainID).legacy();
-        ::std::uint8_t erc20decimals = erc20.decimals();
+        ::std::uint8_t erc20decimals = rpc.run([&]() {
+            return erc20.decimals();
+        });
         decimals = (int32)erc20decimals;
         success = true;
 
@@ -1555,16 +2918,29 @@ void ADefiWalletCoreActor::Erc20Decimals(FString contractAddress,
     }
 }
 
+void ADefiWalletCoreActor::Erc20DecimalsAsync(FString contractAddress,
+                                              FWalletQueryInt32Delegate Out) {
+    ethCallBatched<int32>(
+        getRpcBatcher(), TEXT("Erc20DecimalsAsync"), contractAddress,
+        []() { return FString(CronosAbi::Decimals); },
+        [](const FString &data) {
+            return FCString::Atoi(*CronosAbi::decodeUint256(data));
+        },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc20TotalSupply(FString contractAddress,
                                             FString &totalSupply, bool &success,
                                             FString &output_message) {
     try {
         std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
         Erc20 erc20 =
             new_erc20(mycontractaddress, mycronosrpc, myCronosChainID).legacy();
-        rust::cxxbridge1::String erc20totalSupply =
-            erc20.total_supply().to_string();
+        rust::cxxbridge1::String erc20totalSupply = rpc.run([&]() {
+            return erc20.total_supply().to_string();
+        });
         totalSupply = UTF8_TO_TCHAR(erc20totalSupply.c_str());
 
         success = true;
@@ -1577,6 +2953,15 @@ void ADefiWalletCoreActor::Erc20TotalSupply(FString contractAddress,
     }
 }
 
+void ADefiWalletCoreActor::Erc20TotalSupplyAsync(
+    FString contractAddress, FWalletQueryStringDelegate Out) {
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc20TotalSupplyAsync"), contractAddress,
+        []() { return FString(CronosAbi::TotalSupply); },
+        [](const FString &data) { return CronosAbi::decodeUint256(data); },
+        Out);
+}
+
 void convertVecToTArray(const ::rust::Vec<::std::uint8_t> &src,
                         TArray<uint8> &dst) {
     dst.Empty();
@@ -1621,22 +3006,23 @@ void ADefiWalletCoreActor::Erc20Transfer(FString contractAddress,
             if (NULL == _coreWallet) {
                 result = TEXT("Invalid Wallet");
             } else {
-                char hdpath[100];
-                snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d",
-                         EthCoinType, walletindex);
-                rust::cxxbridge1::Box<PrivateKey> privatekey =
-                    _coreWallet->get_key(hdpath);
+                PrivateKeyCache::Handle privatekey =
+                    getPrivateKey(EthCoinType, walletindex);
 
                 std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
                 std::string mytoaddress = TCHAR_TO_UTF8(*toAddress);
-                std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+                CronosEndpointCall rpc = callCronosRpc(false);
+                std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
                 std::string myamount = TCHAR_TO_UTF8(*amount);
 
                 Erc20 erc20 =
                     new_erc20(mycontractaddress, mycronosrpc, myCronosChainID)
                         .legacy();
                 ::org::defi_wallet_core::CronosTransactionReceiptRaw receipt =
-                    erc20.transfer(mytoaddress, myamount, *privatekey);
+                    rpc.run([&]() {
+                        return erc20.transfer(mytoaddress, myamount,
+                                              **privatekey);
+                    });
                 convertCronosTXReceipt(receipt, txresult);
             }
 
@@ -1645,6 +3031,9 @@ void ADefiWalletCoreActor::Erc20Transfer(FString contractAddress,
                 TEXT("CronosPlayUnreal Erc20Transfer Error: %s"),
                 UTF8_TO_TCHAR(e.what()));
         }
+        // the sdk picks the nonce of erc txs
+        resyncEthNonce(walletindex);
+        invalidateReads(walletindex, contractAddress);
 
         AsyncTask(ENamedThreads::GameThread, [Out, txresult, result]() {
             Out.ExecuteIfBound(txresult, result);
@@ -1672,24 +3061,24 @@ void ADefiWalletCoreActor::Erc20TransferFrom(FString contractAddress,
                 result = TEXT("Invalid Wallet");
 
             } else {
-                char hdpath[100];
-                snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d",
-                         EthCoinType, walletindex);
-                rust::cxxbridge1::Box<PrivateKey> privatekey =
-                    _coreWallet->get_key(hdpath);
+                PrivateKeyCache::Handle privatekey =
+                    getPrivateKey(EthCoinType, walletindex);
 
                 std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
                 std::string myfromaddress = TCHAR_TO_UTF8(*fromAddress);
                 std::string mytoaddress = TCHAR_TO_UTF8(*toAddress);
-                std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+                CronosEndpointCall rpc = callCronosRpc(false);
+                std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
                 std::string myamount = TCHAR_TO_UTF8(*amount);
 
                 Erc20 erc20 =
                     new_erc20(mycontractaddress, mycronosrpc, myCronosChainID)
                         .legacy();
                 ::org::defi_wallet_core::CronosTransactionReceiptRaw receipt =
-                    erc20.transfer_from(myfromaddress, mytoaddress, myamount,
-                                        *privatekey);
+                    rpc.run([&]() {
+                        return erc20.transfer_from(myfromaddress, mytoaddress,
+                                                   myamount, **privatekey);
+                    });
                 convertCronosTXReceipt(receipt, txresult);
             }
 
@@ -1698,6 +3087,9 @@ void ADefiWalletCoreActor::Erc20TransferFrom(FString contractAddress,
                 TEXT("CronosPlayUnreal Erc20TransferFrom Error: %s"),
                 UTF8_TO_TCHAR(e.what()));
         }
+        // the sdk picks the nonce of erc txs
+        resyncEthNonce(walletindex);
+        invalidateReads(walletindex, contractAddress);
 
         AsyncTask(ENamedThreads::GameThread, [Out, txresult, result]() {
             Out.ExecuteIfBound(txresult, result);
@@ -1721,22 +3113,23 @@ void ADefiWalletCoreActor::Erc20Approve(FString contractAddress,
             if (NULL == _coreWallet) {
                 result = TEXT("Invalid Wallet");
             } else {
-                char hdpath[100];
-                snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d",
-                         EthCoinType, walletindex);
-                rust::cxxbridge1::Box<PrivateKey> privatekey =
-                    _coreWallet->get_key(hdpath);
+                PrivateKeyCache::Handle privatekey =
+                    getPrivateKey(EthCoinType, walletindex);
 
                 std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
                 std::string myapprovedAddress = TCHAR_TO_UTF8(*approvedAddress);
-                std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+                CronosEndpointCall rpc = callCronosRpc(false);
+                std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
                 std::string myamount = TCHAR_TO_UTF8(*amount);
 
                 Erc20 erc20 =
                     new_erc20(mycontractaddress, mycronosrpc, myCronosChainID)
                         .legacy();
                 ::org::defi_wallet_core::CronosTransactionReceiptRaw receipt =
-                    erc20.approve(myapprovedAddress, myamount, *privatekey);
+                    rpc.run([&]() {
+                        return erc20.approve(myapprovedAddress, myamount,
+                                             **privatekey);
+                    });
                 convertCronosTXReceipt(receipt, txresult);
             }
 
@@ -1745,6 +3138,9 @@ void ADefiWalletCoreActor::Erc20Approve(FString contractAddress,
                 FString::Printf(TEXT("CronosPlayUnreal Erc20Approve Error: %s"),
                                 UTF8_TO_TCHAR(e.what()));
         }
+        // the sdk picks the nonce of erc txs
+        resyncEthNonce(walletindex);
+        invalidateReads(walletindex, contractAddress);
 
         AsyncTask(ENamedThreads::GameThread, [Out, txresult, result]() {
             Out.ExecuteIfBound(txresult, result);
@@ -1759,14 +3155,16 @@ void ADefiWalletCoreActor::Erc20Allowance(FString contractAddress,
                                           FString &output_message) {
     try {
         std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+        CronosEndpointCall rpc = callCronosRpc();
+        std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
 
         std::string myowner = TCHAR_TO_UTF8(*erc20owner);
         std::string myspender = TCHAR_TO_UTF8(*erc20spender);
         Erc20 erc20 =
             new_erc20(mycontractaddress, mycronosrpc, myCronosChainID).legacy();
-        rust::cxxbridge1::String erc20allowance =
-            erc20.allowance(myowner, myspender);
+        rust::cxxbridge1::String erc20allowance = rpc.run([&]() {
+            return erc20.allowance(myowner, myspender);
+        });
         result = UTF8_TO_TCHAR(erc20allowance.c_str());
 
         success = true;
@@ -1779,6 +3177,32 @@ void ADefiWalletCoreActor::Erc20Allowance(FString contractAddress,
     }
 }
 
+void ADefiWalletCoreActor::Erc20AllowanceAsync(FString contractAddress,
+                                               FString erc20owner,
+                                               FString erc20spender,
+                                               FWalletQueryStringDelegate Out) {
+    ethCallBatched<FString>(
+        getRpcBatcher(), TEXT("Erc20AllowanceAsync"), contractAddress,
+        [=]() {
+            return CronosAbi::Allowance +
+                   CronosAbi::encodeAddress(erc20owner) +
+                   CronosAbi::encodeAddress(erc20spender);
+        },
+        [](const FString &data) { return CronosAbi::decodeUint256(data); },
+        Out);
+}
+
+void ADefiWalletCoreActor::MulticallAsync(TArray<FCronosMulticallItem> items,
+                                          FCronosMulticallDelegate Out) {
+    ethCallBatched<TArray<FCronosMulticallResult>>(
+        getRpcBatcher(), TEXT("MulticallAsync"), getMulticallAddress(),
+        [items]() { return CronosMulticall::encodeAggregate3(items); },
+        [items](const FString &data) {
+            return CronosMulticall::decodeAggregate3(data, items);
+        },
+        Out);
+}
+
 void ADefiWalletCoreActor::Erc721TransferFrom(
     FString contractAddress, int32 walletindex, FString fromAddress,
     FString toAddress, FString tokenid, FErc721TransferFromDelegate Out) {
@@ -1793,24 +3217,24 @@ void ADefiWalletCoreActor::Erc721TransferFrom(
             if (NULL == _coreWallet) {
                 result = TEXT("Invalid Wallet");
             } else {
-                char hdpath[100];
-                snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d",
-                         EthCoinType, walletindex);
-                rust::cxxbridge1::Box<PrivateKey> privatekey =
-                    _coreWallet->get_key(hdpath);
+                PrivateKeyCache::Handle privatekey =
+                    getPrivateKey(EthCoinType, walletindex);
 
                 std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
                 std::string myfromaddress = TCHAR_TO_UTF8(*fromAddress);
                 std::string mytoaddress = TCHAR_TO_UTF8(*toAddress);
-                std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+                CronosEndpointCall rpc = callCronosRpc(false);
+                std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
                 std::string mytokenid = TCHAR_TO_UTF8(*tokenid);
 
                 Erc721 erc721 =
                     new_erc721(mycontractaddress, mycronosrpc, myCronosChainID)
                         .legacy();
                 ::org::defi_wallet_core::CronosTransactionReceiptRaw receipt =
-                    erc721.transfer_from(myfromaddress, mytoaddress, mytokenid,
-                                         *privatekey);
+                    rpc.run([&]() {
+                        return erc721.transfer_from(myfromaddress, mytoaddress,
+                                                    mytokenid, **privatekey);
+                    });
                 convertCronosTXReceipt(receipt, txresult);
             }
         } catch (const std::exception &e) {
@@ -1818,6 +3242,9 @@ void ADefiWalletCoreActor::Erc721TransferFrom(
                 TEXT("CronosPlayUnreal Erc721TransferFrom Error: %s"),
                 UTF8_TO_TCHAR(e.what()));
         }
+        // the sdk picks the nonce of erc txs
+        resyncEthNonce(walletindex);
+        invalidateReads(walletindex, contractAddress);
 
         AsyncTask(ENamedThreads::GameThread, [Out, txresult, result]() {
             Out.ExecuteIfBound(txresult, result);
@@ -1839,24 +3266,25 @@ void ADefiWalletCoreActor::Erc721SafeTransferFrom(
             if (NULL == _coreWallet) {
                 result = TEXT("Invalid Wallet");
             } else {
-                char hdpath[100];
-                snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d",
-                         EthCoinType, walletindex);
-                rust::cxxbridge1::Box<PrivateKey> privatekey =
-                    _coreWallet->get_key(hdpath);
+                PrivateKeyCache::Handle privatekey =
+                    getPrivateKey(EthCoinType, walletindex);
 
                 std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
                 std::string myfromaddress = TCHAR_TO_UTF8(*fromAddress);
                 std::string mytoaddress = TCHAR_TO_UTF8(*toAddress);
-                std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+                CronosEndpointCall rpc = callCronosRpc(false);
+                std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
                 std::string mytokenid = TCHAR_TO_UTF8(*tokenid);
 
                 Erc721 erc721 =
                     new_erc721(mycontractaddress, mycronosrpc, myCronosChainID)
                         .legacy();
                 ::org::defi_wallet_core::CronosTransactionReceiptRaw receipt =
-                    erc721.safe_transfer_from(myfromaddress, mytoaddress,
-                                              mytokenid, *privatekey);
+                    rpc.run([&]() {
+                        return erc721.safe_transfer_from(myfromaddress,
+                                                         mytoaddress, mytokenid,
+                                                         **privatekey);
+                    });
                 convertCronosTXReceipt(receipt, txresult);
             }
 
@@ -1865,6 +3293,9 @@ void ADefiWalletCoreActor::Erc721SafeTransferFrom(
                 TEXT("CronosPlayUnreal Erc721SafeTransferFrom Error: %s"),
                 UTF8_TO_TCHAR(e.what()));
         }
+        // the sdk picks the nonce of erc txs
+        resyncEthNonce(walletindex);
+        invalidateReads(walletindex, contractAddress);
 
         AsyncTask(ENamedThreads::GameThread, [Out, txresult, result]() {
             Out.ExecuteIfBound(txresult, result);
@@ -1888,16 +3319,14 @@ void ADefiWalletCoreActor::Erc721SafeTransferFromWithData(
             if (NULL == _coreWallet) {
                 result = TEXT("Invalid Wallet");
             } else {
-                char hdpath[100];
-                snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d",
-                         EthCoinType, walletindex);
-                rust::cxxbridge1::Box<PrivateKey> privatekey =
-                    _coreWallet->get_key(hdpath);
+                PrivateKeyCache::Handle privatekey =
+                    getPrivateKey(EthCoinType, walletindex);
 
                 std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
                 std::string myfromaddress = TCHAR_TO_UTF8(*fromAddress);
                 std::string mytoaddress = TCHAR_TO_UTF8(*toAddress);
-                std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+                CronosEndpointCall rpc = callCronosRpc(false);
+                std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
                 std::string mytokenid = TCHAR_TO_UTF8(*tokenid);
 
                 ::rust::Vec<::std::uint8_t> myadditionaldata;
@@ -1911,9 +3340,11 @@ void ADefiWalletCoreActor::Erc721SafeTransferFromWithData(
                     new_erc721(mycontractaddress, mycronosrpc, myCronosChainID)
                         .legacy();
                 ::org::defi_wallet_core::CronosTransactionReceiptRaw receipt =
-                    erc721.safe_transfer_from_with_data(
-                        myfromaddress, mytoaddress, mytokenid, myadditionaldata,
-                        *privatekey);
+                    rpc.run([&]() {
+                        return erc721.safe_transfer_from_with_data(
+                            myfromaddress, mytoaddress, mytokenid,
+                            myadditionaldata, **privatekey);
+                    });
                 convertCronosTXReceipt(receipt, txresult);
             }
 
@@ -1923,6 +3354,9 @@ void ADefiWalletCoreActor::Erc721SafeTransferFromWithData(
                      "%s"),
                 UTF8_TO_TCHAR(e.what()));
         }
+        // the sdk picks the nonce of erc txs
+        resyncEthNonce(walletindex);
+        invalidateReads(walletindex, contractAddress);
 
         AsyncTask(ENamedThreads::GameThread, [Out, txresult, result]() {
             Out.ExecuteIfBound(txresult, result);
@@ -1947,24 +3381,23 @@ void ADefiWalletCoreActor::Erc721Approve(FString contractAddress,
                 result = TEXT("Invalid "
                               "Wallet");
             } else {
-                char hdpath[100];
-                snprintf(hdpath, sizeof(hdpath),
-                         "m/44'/%d'/0'/"
-                         "0/%d",
-                         EthCoinType, walletindex);
-                rust::cxxbridge1::Box<PrivateKey> privatekey =
-                    _coreWallet->get_key(hdpath);
+                PrivateKeyCache::Handle privatekey =
+                    getPrivateKey(EthCoinType, walletindex);
 
                 std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
                 std::string myapprovedAddress = TCHAR_TO_UTF8(*approvedAddress);
-                std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+                CronosEndpointCall rpc = callCronosRpc(false);
+                std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
                 std::string mytokenid = TCHAR_TO_UTF8(*tokenid);
 
                 Erc721 erc721 =
                     new_erc721(mycontractaddress, mycronosrpc, myCronosChainID)
                         .legacy();
                 ::org::defi_wallet_core::CronosTransactionReceiptRaw receipt =
-                    erc721.approve(myapprovedAddress, mytokenid, *privatekey);
+                    rpc.run([&]() {
+                        return erc721.approve(myapprovedAddress, mytokenid,
+                                              **privatekey);
+                    });
                 convertCronosTXReceipt(receipt, txresult);
             }
 
@@ -1973,6 +3406,9 @@ void ADefiWalletCoreActor::Erc721Approve(FString contractAddress,
                 TEXT("CronosPlayUnreal Erc721Approve Error: %s"),
                 UTF8_TO_TCHAR(e.what()));
         }
+        // the sdk picks the nonce of erc txs
+        resyncEthNonce(walletindex);
+        invalidateReads(walletindex, contractAddress);
 
         AsyncTask(ENamedThreads::GameThread, [Out, txresult, result]() {
             Out.ExecuteIfBound(txresult, result);
@@ -1996,18 +3432,16 @@ void ADefiWalletCoreActor::Erc1155SafeTransferFrom(
             if (NULL == _coreWallet) {
                 result = TEXT("Invalid Wallet");
             } else {
-                char hdpath[100];
-                snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d",
-                         EthCoinType, walletindex);
-                rust::cxxbridge1::Box<PrivateKey> privatekey =
-                    _coreWallet->get_key(hdpath);
+                PrivateKeyCache::Handle privatekey =
+                    getPrivateKey(EthCoinType, walletindex);
 
                 std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
                 std::string myfromaddress = TCHAR_TO_UTF8(*fromAddress);
                 std::string mytoaddress = TCHAR_TO_UTF8(*toAddress);
                 std::string mytokenid = TCHAR_TO_UTF8(*tokenid);
                 std::string myamount = TCHAR_TO_UTF8(*amount);
-                std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+                CronosEndpointCall rpc = callCronosRpc(false);
+                std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
                 ::rust::Vec<::std::uint8_t> myadditionaldata;
                 myadditionaldata.clear();
                 for (int i = 0; i < additionaldata.Num(); i++) {
@@ -2019,9 +3453,13 @@ void ADefiWalletCoreActor::Erc1155SafeTransferFrom(
                     new_erc1155(mycontractaddress, mycronosrpc, myCronosChainID)
                         .legacy();
                 ::org::defi_wallet_core::CronosTransactionReceiptRaw receipt =
-                    erc1155.safe_transfer_from(myfromaddress, mytoaddress,
-                                               mytokenid, myamount,
-                                               myadditionaldata, *privatekey);
+                    rpc.run([&]() {
+                        return erc1155.safe_transfer_from(myfromaddress,
+                                                          mytoaddress,
+                                                          mytokenid, myamount,
+                                                          myadditionaldata,
+                                                          **privatekey);
+                    });
 
                 convertCronosTXReceipt(receipt, txresult);
             }
@@ -2031,6 +3469,9 @@ void ADefiWalletCoreActor::Erc1155SafeTransferFrom(
                 TEXT("CronosPlayUnreal Erc1155SafeTransferFrom Error: %s"),
                 UTF8_TO_TCHAR(e.what()));
         }
+        // the sdk picks the nonce of erc txs
+        resyncEthNonce(walletindex);
+        invalidateReads(walletindex, contractAddress);
 
         AsyncTask(ENamedThreads::GameThread, [Out, txresult, result]() {
             Out.ExecuteIfBound(txresult, result);
@@ -2056,11 +3497,8 @@ void ADefiWalletCoreActor::Erc1155SafeBatchTransferFrom(
             if (NULL == _coreWallet) {
                 result = TEXT("Invalid Wallet");
             } else {
-                char hdpath[100];
-                snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d",
-                         EthCoinType, walletindex);
-                rust::cxxbridge1::Box<PrivateKey> privatekey =
-                    _coreWallet->get_key(hdpath);
+                PrivateKeyCache::Handle privatekey =
+                    getPrivateKey(EthCoinType, walletindex);
 
                 std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
                 std::string myfromaddress = TCHAR_TO_UTF8(*fromAddress);
@@ -2074,7 +3512,8 @@ void ADefiWalletCoreActor::Erc1155SafeBatchTransferFrom(
                 for (int i = 0; i < amounts.Num(); i++) {
                     myamounts.push_back(TCHAR_TO_UTF8(*amounts[i]));
                 }
-                std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+                CronosEndpointCall rpc = callCronosRpc(false);
+                std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
                 ::rust::Vec<::std::uint8_t> myadditionaldata;
                 myadditionaldata.clear();
                 for (int i = 0; i < additionaldata.Num(); i++) {
@@ -2086,9 +3525,11 @@ void ADefiWalletCoreActor::Erc1155SafeBatchTransferFrom(
                     new_erc1155(mycontractaddress, mycronosrpc, myCronosChainID)
                         .legacy();
                 ::org::defi_wallet_core::CronosTransactionReceiptRaw receipt =
-                    erc1155.safe_batch_transfer_from(
-                        myfromaddress, mytoaddress, mytokenids, myamounts,
-                        myadditionaldata, *privatekey);
+                    rpc.run([&]() {
+                        return erc1155.safe_batch_transfer_from(
+                            myfromaddress, mytoaddress, mytokenids, myamounts,
+                            myadditionaldata, **privatekey);
+                    });
                 convertCronosTXReceipt(receipt, txresult);
             }
         } catch (const std::exception &e) {
@@ -2096,6 +3537,9 @@ void ADefiWalletCoreActor::Erc1155SafeBatchTransferFrom(
                 TEXT("CronosPlayUnreal Erc1155SafeBatchTransferFrom Error: %s"),
                 UTF8_TO_TCHAR(e.what()));
         }
+        // the sdk picks the nonce of erc txs
+        resyncEthNonce(walletindex);
+        invalidateReads(walletindex, contractAddress);
 
         AsyncTask(ENamedThreads::GameThread, [Out, txresult, result]() {
             Out.ExecuteIfBound(txresult, result);
@@ -2121,22 +3565,23 @@ void ADefiWalletCoreActor::Erc1155Approve(FString contractAddress,
             if (NULL == _coreWallet) {
                 result = TEXT("Invalid Wallet");
             } else {
-                char hdpath[100];
-                snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d",
-                         EthCoinType, walletindex);
-                rust::cxxbridge1::Box<PrivateKey> privatekey =
-                    _coreWallet->get_key(hdpath);
+                PrivateKeyCache::Handle privatekey =
+                    getPrivateKey(EthCoinType, walletindex);
 
                 std::string mycontractaddress = TCHAR_TO_UTF8(*contractAddress);
                 std::string myapprovedAddress = TCHAR_TO_UTF8(*approvedAddress);
-                std::string mycronosrpc = TCHAR_TO_UTF8(*myCronosRpc);
+                CronosEndpointCall rpc = callCronosRpc(false);
+                std::string mycronosrpc = TCHAR_TO_UTF8(*rpc.url);
 
                 Erc1155 erc1155 =
                     new_erc1155(mycontractaddress, mycronosrpc, myCronosChainID)
                         .legacy();
                 ::org::defi_wallet_core::CronosTransactionReceiptRaw receipt =
-                    erc1155.set_approval_for_all(myapprovedAddress, approved,
-                                                 *privatekey);
+                    rpc.run([&]() {
+                        return erc1155.set_approval_for_all(myapprovedAddress,
+                                                            approved,
+                                                            **privatekey);
+                    });
                 convertCronosTXReceipt(receipt, txresult);
             }
         } catch (const std::exception &e) {
@@ -2144,6 +3589,9 @@ void ADefiWalletCoreActor::Erc1155Approve(FString contractAddress,
                 TEXT("CronosPlayUnreal Erc1155Approve Error: %s"),
                 UTF8_TO_TCHAR(e.what()));
         }
+        // the sdk picks the nonce of erc txs
+        resyncEthNonce(walletindex);
+        invalidateReads(walletindex, contractAddress);
 
         AsyncTask(ENamedThreads::GameThread, [Out, txresult, result]() {
             Out.ExecuteIfBound(txresult, result);
@@ -2165,6 +3613,51 @@ org::defi_wallet_core::Wallet *ADefiWalletCoreActor::getCoreWallet() {
     return _coreWallet;
 }
 
+CronosEndpointCall ADefiWalletCoreActor::callCronosRpc(bool timed) {
+    TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe> pool =
+        CronosEndpointPool::forEndpoints(myCronosRpc,
+                                         CronosEndpointPool::EProbe::JsonRpc);
+    return CronosEndpointCall(pool, pool->pick(), timed);
+}
+
+CronosEndpointCall ADefiWalletCoreActor::callTendermintRpc(bool timed) {
+    TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe> pool =
+        CronosEndpointPool::forEndpoints(
+            myTendermintRpc, CronosEndpointPool::EProbe::Tendermint);
+    return CronosEndpointCall(pool, pool->pick(), timed);
+}
+
+CronosEndpointCall ADefiWalletCoreActor::callGrpc(bool timed) {
+    TSharedRef<CronosEndpointPool, ESPMode::ThreadSafe> pool =
+        CronosEndpointPool::forEndpoints(myGrpc,
+                                         CronosEndpointPool::EProbe::Connect);
+    return CronosEndpointCall(pool, pool->pick(), timed);
+}
+
+PrivateKeyCache::Handle ADefiWalletCoreActor::getPrivateKey(int32 cointype,
+                                                            int32 walletIndex) {
+    FRWScopeLock walletlock(_walletLock, SLT_ReadOnly);
+    if (NULL == _coreWallet) {
+        throw std::runtime_error("Invalid Wallet");
+    }
+    return _privateKeyCache->get(*_coreWallet, cointype, 0, walletIndex);
+}
+
+FString ADefiWalletCoreActor::getWalletAddress(CoinType coin, int32 index) {
+    FRWScopeLock walletlock(_walletLock, SLT_ReadOnly);
+    if (NULL == _coreWallet) {
+        throw std::runtime_error("Invalid Wallet");
+    }
+    return _addressCache->get(*_coreWallet, coin, index);
+}
+
+void ADefiWalletCoreActor::adoptWallet(
+    rust::cxxbridge1::Box<org::defi_wallet_core::Wallet> wallet) {
+    FRWScopeLock walletlock(_walletLock, SLT_Write);
+    // ownership transferred
+    _coreWallet = wallet.into_raw();
+}
+
 UDynamicContractObject *ADefiWalletCoreActor::CreateDynamicSigningContract(
     FString contractaddress, FString abijson, int32 walletindex, bool &success,
     FString &output_message) {
@@ -1,6 +1,7 @@
 // Copyright 2022, Cronos Labs. All Rights Reserved
 
 #include "DynamicContractObject.h"
+#include "CronosEndpointPool.h"
 
 UDynamicContractObject::UDynamicContractObject() {
     defiWallet = NULL;
@@ -177,14 +178,13 @@ void UDynamicContractObject::NewSigningEthContract(FString contractaddress,
             return;
         }
 
-        char hdpath[100];
-        snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/0'/0/%d", EthCoinType,
-                 walletindex);
-        rust::cxxbridge1::Box<PrivateKey> privatekey =
-            defiWallet->getCoreWallet()->get_key(hdpath);
+        std::shared_ptr<rust::cxxbridge1::Box<PrivateKey>> privatekey =
+            defiWallet->getPrivateKey(EthCoinType, walletindex);
 
         assert(defiWallet != NULL);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*defiWallet->myCronosRpc);
+        // kept by the contract, its calls don't reach the endpoint pool
+        std::string mycronosrpc =
+            TCHAR_TO_UTF8(*defiWallet->callCronosRpc().url);
         int32 chainid = defiWallet->myCronosChainID;
 
         std::string mycontract = TCHAR_TO_UTF8(*contractaddress);
@@ -192,7 +192,7 @@ void UDynamicContractObject::NewSigningEthContract(FString contractaddress,
 
         rust::cxxbridge1::Box<EthContract> tmpContract =
             new_signing_eth_contract(mycronosrpc, mycontract, myjson,
-                                     *privatekey, chainid);
+                                     **privatekey, chainid);
         // ownership transferred
         _coreContract = tmpContract.into_raw();
 
@@ -222,7 +222,9 @@ void UDynamicContractObject::NewEthContract(FString contractaddress,
         }
 
         assert(defiWallet != NULL);
-        std::string mycronosrpc = TCHAR_TO_UTF8(*defiWallet->myCronosRpc);
+        // kept by the contract, its calls don't reach the endpoint pool
+        std::string mycronosrpc =
+            TCHAR_TO_UTF8(*defiWallet->callCronosRpc().url);
         std::string mycontract = TCHAR_TO_UTF8(*contractaddress);
         std::string myjson = TCHAR_TO_UTF8(*abijson);
 
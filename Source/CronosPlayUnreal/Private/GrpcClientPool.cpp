@@ -0,0 +1,85 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "GrpcClientPool.h"
+
+#include <exception>
+
+#include "PlayCppSdkLibrary/Include/rust/cxx.h"
+
+using namespace std;
+using namespace org::defi_wallet_core;
+
+static void destroyGrpcClient(GrpcClient *client) {
+    // restored back, freed when going out of scope
+    rust::cxxbridge1::Box<GrpcClient> tmpclient =
+        rust::cxxbridge1::Box<GrpcClient>::from_raw(client);
+}
+
+GrpcClientPool::Lease::Lease(GrpcClientPool *newpool, std::string newurl,
+                             GrpcClient *newclient, uint64_t newgeneration)
+    : pool(newpool), url(std::move(newurl)), client(newclient),
+      exceptions(std::uncaught_exceptions()), generation(newgeneration) {}
+
+GrpcClientPool::Lease::Lease(Lease &&other) noexcept
+    : pool(other.pool), url(std::move(other.url)), client(other.client),
+      exceptions(other.exceptions), generation(other.generation) {
+    other.client = NULL;
+}
+
+GrpcClientPool::Lease::~Lease() {
+    if (client != NULL) {
+        pool->release(url, client, std::uncaught_exceptions() <= exceptions,
+                      generation);
+    }
+}
+
+GrpcClientPool::~GrpcClientPool() { clear(); }
+
+GrpcClientPool::Lease GrpcClientPool::acquire(const std::string &grpcurl) {
+    uint64_t leasegeneration;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        leasegeneration = generation;
+        std::vector<GrpcClient *> &clients = idle[grpcurl];
+        if (!clients.empty()) {
+            GrpcClient *client = clients.back();
+            clients.pop_back();
+            reusedcount++;
+            return Lease(this, grpcurl, client, leasegeneration);
+        }
+    }
+
+    // connect outside of the lock, may throw
+    rust::cxxbridge1::Box<GrpcClient> newclient = new_grpc_client(grpcurl);
+    createdcount++;
+    return Lease(this, grpcurl, newclient.into_raw(), leasegeneration);
+}
+
+void GrpcClientPool::release(const std::string &grpcurl, GrpcClient *client,
+                             bool healthy, uint64_t leasegeneration) {
+    if (healthy) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<GrpcClient *> &clients = idle[grpcurl];
+        // clients leased before clear() are not pooled again
+        if (leasegeneration == generation &&
+            clients.size() < MaxIdlePerEndpoint) {
+            clients.push_back(client);
+            return;
+        }
+    }
+    destroyGrpcClient(client);
+}
+
+void GrpcClientPool::clear() {
+    std::map<std::string, std::vector<GrpcClient *>> removed;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        removed.swap(idle);
+        generation++;
+    }
+    for (auto &endpoint : removed) {
+        for (GrpcClient *client : endpoint.second) {
+            destroyGrpcClient(client);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "PlayCppSdkLibrary/Include/defi-wallet-core-cpp/src/nft.rs.h"
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * pool of long-lived grpc clients, one idle list per grpc endpoint
+ * a client is used by one thread at a time, concurrent queries get their own
+ * client, which goes back to the pool when the query finishes
+ */
+class GrpcClientPool {
+  public:
+    /**
+     * exclusive use of a pooled client
+     * if the lease is released while an exception is in flight, the client is
+     * destroyed instead of being returned, the next acquire builds a new
+     * channel
+     */
+    class Lease {
+        GrpcClientPool *pool;
+        std::string url;
+        org::defi_wallet_core::GrpcClient *client;
+        int exceptions;
+        // clear() count of the pool when the client was leased
+        uint64_t generation;
+
+      public:
+        Lease(GrpcClientPool *newpool, std::string newurl,
+              org::defi_wallet_core::GrpcClient *newclient,
+              uint64_t newgeneration);
+        Lease(Lease &&other) noexcept;
+        Lease(const Lease &) = delete;
+        Lease &operator=(const Lease &) = delete;
+        Lease &operator=(Lease &&) = delete;
+        ~Lease();
+
+        const org::defi_wallet_core::GrpcClient *operator->() const {
+            return client;
+        }
+    };
+
+    // idle clients kept per endpoint, extra ones are destroyed on release
+    static const size_t MaxIdlePerEndpoint = 4;
+
+    ~GrpcClientPool();
+
+    Lease acquire(const std::string &grpcurl);
+
+    // destroy all idle clients, leased clients are destroyed on release
+    void clear();
+
+    uint64_t getReusedCount() const { return reusedcount; }
+    uint64_t getCreatedCount() const { return createdcount; }
+
+  private:
+    std::mutex mutex;
+    std::map<std::string, std::vector<org::defi_wallet_core::GrpcClient *>>
+        idle;
+    std::atomic<uint64_t> reusedcount{0};
+    std::atomic<uint64_t> createdcount{0};
+    // bumped by clear(), older clients are not pooled again
+    uint64_t generation = 0;
+
+    void release(const std::string &grpcurl,
+                 org::defi_wallet_core::GrpcClient *client, bool healthy,
+                 uint64_t leasegeneration);
+};
@@ -0,0 +1,69 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "NonceManager.h"
+
+#include <algorithm>
+
+#include "CronosEndpointPool.h"
+
+#include "PlayCppSdkLibrary/Include/defi-wallet-core-cpp/src/lib.rs.h"
+#include "PlayCppSdkLibrary/Include/rust/cxx.h"
+
+using namespace std;
+using namespace org::defi_wallet_core;
+
+static auto nonceKey(std::string address, uint64_t chainid) -> std::string {
+    std::transform(address.begin(), address.end(), address.begin(),
+                   ::tolower);
+    return address + ":" + std::to_string(chainid);
+}
+
+std::shared_ptr<NonceManager::Entry>
+NonceManager::entry(const std::string &address, uint64_t chainid) {
+    std::string key = nonceKey(address, chainid);
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<Entry> &found = entries[key];
+    if (!found) {
+        found = std::make_shared<Entry>();
+    }
+    return found;
+}
+
+uint64_t NonceManager::acquire(const std::string &address,
+                               const CronosEndpointCall &cronosrpc,
+                               uint64_t chainid, uint64_t count) {
+    std::shared_ptr<Entry> nonceentry = entry(address, chainid);
+    if (!nonceentry->synced.load()) {
+        // only one thread fetches, the others wait for its result
+        std::lock_guard<std::mutex> lock(nonceentry->fetchmutex);
+        if (!nonceentry->synced.load()) {
+            rust::String nonce = cronosrpc.run([&]() {
+                return get_eth_nonce(address, TCHAR_TO_UTF8(*cronosrpc.url));
+            });
+            nonceentry->next.store(std::stoull(nonce.c_str()));
+            nonceentry->synced.store(true);
+        }
+    }
+    return nonceentry->next.fetch_add(count);
+}
+
+void NonceManager::release(const std::string &address, uint64_t chainid,
+                           uint64_t nonce, uint64_t count) {
+    std::shared_ptr<Entry> nonceentry = entry(address, chainid);
+    uint64_t expected = nonce + count;
+    if (!nonceentry->next.compare_exchange_strong(expected, nonce)) {
+        // a later nonce is already handed out
+        nonceentry->synced.store(false);
+    }
+}
+
+void NonceManager::resync(const std::string &address, uint64_t chainid) {
+    entry(address, chainid)->synced.store(false);
+}
+
+void NonceManager::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &found : entries) {
+        found.second->synced.store(false);
+    }
+}
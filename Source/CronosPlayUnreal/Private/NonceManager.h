@@ -0,0 +1,59 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+class CronosEndpointCall;
+
+/**
+ * hands out evm nonces locally, so sends from one address don't race for the
+ * same nonce and don't fetch it before every transaction
+ * key: address (case-insensitive) and chain-id
+ * the nonce is fetched on first use and after resync()
+ * all methods are thread-safe
+ */
+class NonceManager {
+    struct Entry {
+        std::mutex fetchmutex;
+        std::atomic<bool> synced{false};
+        std::atomic<uint64_t> next{0};
+    };
+
+    std::mutex mutex;
+    std::map<std::string, std::shared_ptr<Entry>> entries;
+
+    std::shared_ptr<Entry> entry(const std::string &address,
+                                 uint64_t chainid);
+
+  public:
+    /**
+     * next nonce of address, or the first of count consecutive nonces
+     * fetches the nonce through cronosrpc if not synced, throws if that
+     * fails
+     */
+    uint64_t acquire(const std::string &address,
+                     const CronosEndpointCall &cronosrpc, uint64_t chainid,
+                     uint64_t count = 1);
+
+    /**
+     * count nonces from nonce on were acquired but never broadcast (e.g.
+     * signing failed)
+     * rolls back if they're the latest ones, otherwise resyncs to close the gap
+     */
+    void release(const std::string &address, uint64_t chainid, uint64_t nonce,
+                 uint64_t count = 1);
+
+    /**
+     * fetch the nonce again on next acquire
+     * call after a broadcast failed (nonce too low/high, dropped tx) or the
+     * address sent a tx whose nonce was picked elsewhere
+     */
+    void resync(const std::string &address, uint64_t chainid);
+
+    // resync every address
+    void clear();
+};
@@ -13,9 +13,11 @@
 #include "Serialization/JsonSerializer.h"
 #include "Dom/JsonObject.h"
 #include "Utlis.h"
+#include "CronosGasOracle.h"
 
 #include <iostream>
 #include <memory>
+#include <stdexcept>
 
 using namespace std;
 using namespace rust;
@@ -136,6 +138,8 @@ APlayCppSdkActor::APlayCppSdkActor() {
     // improve performance if you don't need it.
     PrimaryActorTick.bCanEverTick = false;
     _coreClient = NULL;
+    myCronosRpcs.Add(25, TEXT("https://evm.cronos.org"));
+    myCronosRpcs.Add(338, TEXT("https://evm-dev-t3.cronos.org"));
 }
 
 // Called when the game starts or when spawned
@@ -1179,7 +1183,19 @@ void APlayCppSdkActor::setCommon(WalletConnectTxCommon &common,
     common.web3api_url = "https://evm-dev-t3.cronos.org"; // uncessary, placeholder
     common.chainid = (uint64)GetChainId();
     common.gas_limit = TCHAR_TO_UTF8(*gaslimit);
-    common.gas_price = TCHAR_TO_UTF8(*gasprice);
+    if (!CronosGasOracle::isAuto(gasprice)) {
+        common.gas_price = TCHAR_TO_UTF8(*gasprice);
+        return;
+    }
+    // priced on the chain of the session, throws into the std::exception
+    // handler of the caller
+    const FString *rpc = myCronosRpcs.Find((int32)common.chainid);
+    if (rpc == NULL || rpc->IsEmpty()) {
+        throw std::runtime_error("myCronosRpcs has no rpc of chain-id " +
+                                 std::to_string(common.chainid));
+    }
+    common.gas_price = TCHAR_TO_UTF8(
+        *CronosGasOracle::forEndpoint(*rpc)->resolve(gasprice));
 }
 
 void APlayCppSdkActor::Erc20Approve(
@@ -1,6 +1,7 @@
 // Copyright 2022, Cronos Labs. All Rights Reserved
 
 #include "PlayCppSdkBPLibrary.h"
+#include "AsyncQuery.h"
 #include "CronosPlayUnreal.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
@@ -75,6 +76,17 @@ void UPlayCppSdkBPLibrary::GetTokensBlocking(FString blockscoutBaseUrl,
     }
 }
 
+void UPlayCppSdkBPLibrary::GetTokensAsync(FString blockscoutBaseUrl,
+                                          FString account_address,
+                                          FRawTokenResultsDelegate Out) {
+    runQueryAsync<TArray<FRawTokenResult>>(
+        Out, [=](TArray<FRawTokenResult> &output, bool &success,
+                 FString &output_message) {
+            GetTokensBlocking(blockscoutBaseUrl, account_address, output,
+                              success, output_message);
+        });
+}
+
 /// blackscout
 void UPlayCppSdkBPLibrary::GetTokenTransfersBlocking(
     FString blockscoutBaseUrl, FString address, FString contractAddress,
@@ -99,6 +111,20 @@ void UPlayCppSdkBPLibrary::GetTokenTransfersBlocking(
     }
 }
 
+void UPlayCppSdkBPLibrary::GetTokenTransfersAsync(FString blockscoutBaseUrl,
+                                                  FString address,
+                                                  FString contractAddress,
+                                                  EQueryOption option,
+                                                  FRawTxDetailsDelegate Out) {
+    runQueryAsync<TArray<FRawTxDetail>>(
+        Out, [=](TArray<FRawTxDetail> &output, bool &success,
+                 FString &output_message) {
+            GetTokenTransfersBlocking(blockscoutBaseUrl, address,
+                                      contractAddress, option, output, success,
+                                      output_message);
+        });
+}
+
 void UPlayCppSdkBPLibrary::GetErc20TransferHistoryBlocking(
     FString address, FString contractaddress, EQueryOption option,
     FString api_key, TArray<FRawTxDetail> &output, bool &success,
@@ -122,6 +148,18 @@ void UPlayCppSdkBPLibrary::GetErc20TransferHistoryBlocking(
     }
 }
 
+void UPlayCppSdkBPLibrary::GetErc20TransferHistoryAsync(
+    FString address, FString ContractAddress, EQueryOption option,
+    FString api_key, FRawTxDetailsDelegate Out) {
+    runQueryAsync<TArray<FRawTxDetail>>(
+        Out, [=](TArray<FRawTxDetail> &output, bool &success,
+                 FString &output_message) {
+            GetErc20TransferHistoryBlocking(address, ContractAddress, option,
+                                            api_key, output, success,
+                                            output_message);
+        });
+}
+
 void UPlayCppSdkBPLibrary::GetErc721TransferHistoryBlocking(
     FString address, FString contractaddress, EQueryOption option,
     FString api_key, TArray<FRawTxDetail> &output, bool &success,
@@ -144,6 +182,18 @@ void UPlayCppSdkBPLibrary::GetErc721TransferHistoryBlocking(
     }
 }
 
+void UPlayCppSdkBPLibrary::GetErc721TransferHistoryAsync(
+    FString address, FString ContractAddress, EQueryOption option,
+    FString api_key, FRawTxDetailsDelegate Out) {
+    runQueryAsync<TArray<FRawTxDetail>>(
+        Out, [=](TArray<FRawTxDetail> &output, bool &success,
+                 FString &output_message) {
+            GetErc721TransferHistoryBlocking(address, ContractAddress, option,
+                                             api_key, output, success,
+                                             output_message);
+        });
+}
+
 void UPlayCppSdkBPLibrary::GetTransactionHistoryBlocking(
     FString address, FString apikey, TArray<FRawTxDetail> &output,
     bool &success, FString &output_message) {
@@ -162,6 +212,16 @@ void UPlayCppSdkBPLibrary::GetTransactionHistoryBlocking(
     }
 }
 
+void UPlayCppSdkBPLibrary::GetTransactionHistoryAsync(
+    FString address, FString apikey, FRawTxDetailsDelegate Out) {
+    runQueryAsync<TArray<FRawTxDetail>>(
+        Out, [=](TArray<FRawTxDetail> &output, bool &success,
+                 FString &output_message) {
+            GetTransactionHistoryBlocking(address, apikey, output, success,
+                                          output_message);
+        });
+}
+
 FTexturePlatformData *GetTexturePlatformData(UTexture2D *Texture) {
 #if ENGINE_MAJOR_VERSION == 4
     return Texture->PlatformData;
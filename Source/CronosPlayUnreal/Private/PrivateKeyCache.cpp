@@ -0,0 +1,70 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "PrivateKeyCache.h"
+
+#include <algorithm>
+#include <cstdio>
+
+using namespace std;
+using namespace org::defi_wallet_core;
+
+PrivateKeyCache::Handle PrivateKeyCache::get(const Wallet &wallet,
+                                             int32_t cointype, int32_t account,
+                                             int32_t index) {
+    char hdpath[100];
+    // m / purpose' / coin_type' / account' / change / address_index
+    snprintf(hdpath, sizeof(hdpath), "m/44'/%d'/%d'/0/%d", cointype, account,
+             index);
+    std::string key = hdpath;
+    std::chrono::steady_clock::time_point now =
+        std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        evictIdleLocked(now);
+        auto found = entries.find(key);
+        if (found != entries.end()) {
+            found->second.lastused = now;
+            return found->second.key;
+        }
+    }
+
+    // derive outside the lock, a racing thread may derive the same key once
+    Handle privatekey = std::make_shared<rust::cxxbridge1::Box<PrivateKey>>(
+        wallet.get_key(hdpath));
+    std::lock_guard<std::mutex> lock(mutex);
+    Entry &entry = entries[key];
+    if (!entry.key) {
+        entry.key = privatekey;
+    }
+    entry.lastused = now;
+    return entry.key;
+}
+
+void PrivateKeyCache::setIdleTimeout(std::chrono::milliseconds timeout) {
+    std::lock_guard<std::mutex> lock(mutex);
+    idletimeout = std::max(timeout, std::chrono::milliseconds(0));
+}
+
+void PrivateKeyCache::evictIdleLocked(
+    std::chrono::steady_clock::time_point now) {
+    if (idletimeout.count() == 0) {
+        return;
+    }
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (now - it->second.lastused > idletimeout) {
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void PrivateKeyCache::evictIdle() {
+    std::lock_guard<std::mutex> lock(mutex);
+    evictIdleLocked(std::chrono::steady_clock::now());
+}
+
+void PrivateKeyCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+}
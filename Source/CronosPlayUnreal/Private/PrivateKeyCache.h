@@ -0,0 +1,55 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "PlayCppSdkLibrary/Include/defi-wallet-core-cpp/src/lib.rs.h"
+#include "PlayCppSdkLibrary/Include/rust/cxx.h"
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * keeps derived private keys of the hd wallet, so signing doesn't run bip-32
+ * derivation for every transaction
+ * key: coin type, account and address index of m/44'/coin'/account'/0/index
+ * keys are handed out as shared handles: clear() or an idle eviction never
+ * frees a key another thread is signing with, the last handle drops it
+ * all methods are thread-safe
+ */
+class PrivateKeyCache {
+  public:
+    typedef std::shared_ptr<
+        rust::cxxbridge1::Box<org::defi_wallet_core::PrivateKey>>
+        Handle;
+
+  private:
+    struct Entry {
+        Handle key;
+        std::chrono::steady_clock::time_point lastused;
+    };
+
+    std::mutex mutex;
+    std::map<std::string, Entry> entries;
+    // 0 keeps keys until clear()
+    std::chrono::milliseconds idletimeout{0};
+
+    // drop keys unused for idletimeout, caller must hold mutex
+    void evictIdleLocked(std::chrono::steady_clock::time_point now);
+
+  public:
+    /**
+     * private key of m/44'/cointype'/account'/0/index, derived from wallet
+     * on first use, throws if derivation fails
+     */
+    Handle get(const org::defi_wallet_core::Wallet &wallet, int32_t cointype,
+               int32_t account, int32_t index);
+
+    // drop keys unused for that long, 0 disables
+    void setIdleTimeout(std::chrono::milliseconds timeout);
+
+    void evictIdle();
+
+    // drop every key, call before the wallet is destroyed
+    void clear();
+};
@@ -0,0 +1,81 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#include "ReadCache.h"
+
+FString ReadCache::readKey(int64 chainid, const TCHAR *query,
+                           const FString &contract, const FString &args) {
+    return FString::Printf(TEXT("%lld|%s|%s|%s"), chainid, query,
+                           *contract.ToLower(), *args.ToLower());
+}
+
+void ReadCache::setTtl(float seconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ttl = FMath::Max(0.0f, seconds);
+    if (ttl == 0.0f) {
+        entries.Empty();
+    }
+}
+
+bool ReadCache::get(const FString &key, FString &value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Entry *found = entries.Find(key);
+    if (found == NULL) {
+        return false;
+    }
+    if (found->expires <= FPlatformTime::Seconds() ||
+        found->block < blocknumber) {
+        entries.Remove(key);
+        return false;
+    }
+    value = found->value;
+    return true;
+}
+
+uint64 ReadCache::begin() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return generation;
+}
+
+void ReadCache::put(const FString &key, const FString &value,
+                    uint64 started) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // a block or our own tx landed meanwhile, the answer may predate it
+    if (ttl == 0.0f || started != generation) {
+        return;
+    }
+    Entry entry;
+    entry.value = value;
+    entry.block = blocknumber;
+    entry.expires = FPlatformTime::Seconds() + ttl;
+    entries.Add(key, entry);
+}
+
+void ReadCache::onNewBlock(uint64 number) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (number <= blocknumber) {
+        return;
+    }
+    blocknumber = number;
+    generation++;
+    entries.Empty();
+}
+
+void ReadCache::invalidate(const FString &address) {
+    FString needle = address.ToLower();
+    std::lock_guard<std::mutex> lock(mutex);
+    generation++;
+    if (needle.IsEmpty()) {
+        return;
+    }
+    for (auto it = entries.CreateIterator(); it; ++it) {
+        if (it.Key().Contains(needle)) {
+            it.RemoveCurrent();
+        }
+    }
+}
+
+void ReadCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    generation++;
+    entries.Empty();
+}
@@ -0,0 +1,57 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include <mutex>
+
+/**
+ * answers of balance and ownership reads by (chain, query, contract, args),
+ * valid until the next block or for the ttl, whichever ends first
+ * entries mentioning an address are dropped when our own txs touching it are
+ * done, so a read after a send never returns the balance from before it
+ * all methods are thread-safe
+ */
+class ReadCache {
+    struct Entry {
+        FString value;
+        // block number known when the read started, 0 if unknown
+        uint64 block;
+        double expires;
+    };
+
+    std::mutex mutex;
+    TMap<FString, Entry> entries;
+    float ttl = 5.0f;
+    uint64 blocknumber = 0;
+    // bumped on every invalidation, reads started before one aren't stored
+    uint64 generation = 0;
+
+  public:
+    /**
+     * key of a read, addresses are lowercased so invalidate() finds them
+     * @param query the read, e.g. "Erc20Balance", the same for the blocking
+     * and the Async function so they share answers
+     */
+    static FString readKey(int64 chainid, const TCHAR *query,
+                           const FString &contract, const FString &args);
+
+    // seconds an answer is kept at most, 0 disables the cache
+    void setTtl(float seconds);
+
+    // the cached answer of key, if still valid
+    bool get(const FString &key, FString &value);
+
+    // generation to pass to put(), taken before sending the read
+    uint64 begin();
+
+    // store the answer of a read begun at generation, unless invalidated since
+    void put(const FString &key, const FString &value, uint64 started);
+
+    // a new block, every answer from an older block is dropped
+    void onNewBlock(uint64 number);
+
+    // drop the answers whose contract or args mention address
+    void invalidate(const FString &address);
+
+    void clear();
+};
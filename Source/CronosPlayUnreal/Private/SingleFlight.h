@@ -0,0 +1,69 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include <atomic>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * coalesces identical concurrent blocking queries: the first caller of a key
+ * runs the query, callers of the same key arriving meanwhile wait for its
+ * result (or exception) instead of querying again
+ * nothing is cached, a key is forgotten as soon as its query returns
+ * the key must encode the result type, e.g. "nft_denom|endpoint|denomid"
+ * all methods are thread-safe
+ */
+class SingleFlight {
+    std::mutex mutex;
+    // key -> std::shared_future<T> of the running query
+    std::map<std::string, std::shared_ptr<void>> flights;
+    std::atomic<uint64_t> coalescedcount{0};
+
+  public:
+    template <typename T>
+    T run(const std::string &key, const std::function<T()> &query) {
+        std::shared_ptr<std::promise<T>> promise;
+        std::shared_future<T> future;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto found = flights.find(key);
+            if (found != flights.end()) {
+                future = *std::static_pointer_cast<std::shared_future<T>>(
+                    found->second);
+                coalescedcount++;
+            } else {
+                promise = std::make_shared<std::promise<T>>();
+                future = promise->get_future().share();
+                flights[key] = std::make_shared<std::shared_future<T>>(future);
+            }
+        }
+        if (!promise) {
+            // rethrows the exception of the query
+            return future.get();
+        }
+
+        try {
+            T result = query();
+            forget(key);
+            promise->set_value(result);
+            return result;
+        } catch (...) {
+            forget(key);
+            promise->set_exception(std::current_exception());
+            throw;
+        }
+    }
+
+    // how many callers got the result of another caller's query
+    uint64_t getCoalescedCount() const { return coalescedcount; }
+
+  private:
+    void forget(const std::string &key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        flights.erase(key);
+    }
+};
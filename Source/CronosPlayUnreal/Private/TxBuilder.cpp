@@ -6,10 +6,16 @@
 #include <sstream>
 
 #include "PlayCppSdkLibrary/Include/defi-wallet-core-cpp/src/lib.rs.h"
+#include "PlayCppSdkLibrary/Include/defi-wallet-core-cpp/src/nft.rs.h"
 
 using namespace std;
 using namespace org::defi_wallet_core;
 
+// gas limits per message kind, a bank send fits the 100000 of SendAmount
+static const uint64_t BankSendGas = 100000;
+static const uint64_t NftTransferGas = 150000;
+static const uint64_t StakingDelegateGas = 200000;
+
 void TxDirector::setBuilder(TxBuilder *newbuilder) { builder = newbuilder; }
 
 CosmosSDKTxInfoRaw TxDirector::makeTx() {
@@ -33,3 +39,68 @@ void CosmosSendAmountTxBuilder::setData() {
 }
 
 CosmosSDKTxInfoRaw CosmosSendAmountTxBuilder::getTxInfo() { return info; }
+
+void CosmosSequentialTxBuilder::setData() {
+    info.account_number = 0;
+    info.sequence_number = 0;
+    info.gas_limit = BankSendGas;
+    info.fee_amount = 1000000;
+    info.fee_denom = "basecro";
+    info.timeout_height = 0;
+    info.memo_note = "";
+    info.chain_id = "";
+    info.coin_type = 394;
+    info.bech32hrp = "cro";
+    // same price as CosmosSendAmountTxBuilder
+    gasPrice = info.fee_amount / info.gas_limit;
+}
+
+CosmosSDKTxInfoRaw CosmosSequentialTxBuilder::getTxInfo() { return info; }
+
+void CosmosSequentialTxBuilder::addBankSend(const std::string &recipient,
+                                            uint64_t amount,
+                                            const std::string &denom) {
+    messages.push_back(
+        {BankSendGas, [=](CosmosSDKTxInfoRaw txinfo,
+                          const PrivateKey &privatekey) {
+             return get_single_bank_send_signed_tx(txinfo, privatekey,
+                                                   recipient, amount, denom);
+         }});
+}
+
+void CosmosSequentialTxBuilder::addNftTransfer(const std::string &id,
+                                               const std::string &denomid,
+                                               const std::string &recipient) {
+    messages.push_back(
+        {NftTransferGas, [=](CosmosSDKTxInfoRaw txinfo,
+                             const PrivateKey &privatekey) {
+             return get_nft_transfer_signed_tx(txinfo, privatekey, id,
+                                               denomid, recipient);
+         }});
+}
+
+void CosmosSequentialTxBuilder::addStakingDelegate(const std::string &validator,
+                                                   uint64_t amount,
+                                                   const std::string &denom) {
+    messages.push_back(
+        {StakingDelegateGas, [=](CosmosSDKTxInfoRaw txinfo,
+                                 const PrivateKey &privatekey) {
+             return get_staking_delegate_signed_tx(txinfo, privatekey,
+                                                   validator, amount, denom,
+                                                   false);
+         }});
+}
+
+size_t CosmosSequentialTxBuilder::size() const { return messages.size(); }
+
+rust::cxxbridge1::Vec<uint8_t>
+CosmosSequentialTxBuilder::sign(size_t index, const PrivateKey &privatekey,
+                                const CosmosAccountInfoRaw &accountinfo) const {
+    const Message &message = messages.at(index);
+    CosmosSDKTxInfoRaw txinfo = info;
+    txinfo.account_number = accountinfo.account_number;
+    txinfo.sequence_number = accountinfo.sequence_number;
+    txinfo.gas_limit = message.gas;
+    txinfo.fee_amount = message.gas * gasPrice;
+    return message.sign(txinfo, privatekey);
+}
@@ -3,7 +3,10 @@
 #ifndef TxBuilder_hpp
 #define TxBuilder_hpp
 #include "PlayCppSdkLibrary/Include/defi-wallet-core-cpp/src/lib.rs.h"
+#include <functional>
 #include <stdio.h>
+#include <string>
+#include <vector>
 
 class TxBuilder {
   public:
@@ -29,4 +32,45 @@ class CosmosSendAmountTxBuilder : public TxBuilder {
     org::defi_wallet_core::CosmosSDKTxInfoRaw getTxInfo();
 };
 
+// many messages of one sender, sent as one single-message tx per message
+// with consecutive sequences, not as one multi-message tx: CosmosSDKMsgRaw
+// can't be built outside the sdk
+// so n messages are n txs, each with its own fee and gas scaled for the
+// message, and not atomic: a rejected tx doesn't undo the ones before it
+class CosmosSequentialTxBuilder : public TxBuilder {
+    typedef std::function<rust::cxxbridge1::Vec<uint8_t>(
+        org::defi_wallet_core::CosmosSDKTxInfoRaw txinfo,
+        const org::defi_wallet_core::PrivateKey &privatekey)>
+        SignFunction;
+
+    struct Message {
+        uint64_t gas;
+        SignFunction sign;
+    };
+    std::vector<Message> messages;
+
+  public:
+    org::defi_wallet_core::CosmosSDKTxInfoRaw info;
+    // fee per gas in info.fee_denom
+    uint64_t gasPrice;
+    void setData();
+
+    org::defi_wallet_core::CosmosSDKTxInfoRaw getTxInfo();
+
+    void addBankSend(const std::string &recipient, uint64_t amount,
+                     const std::string &denom);
+    void addNftTransfer(const std::string &id, const std::string &denomid,
+                        const std::string &recipient);
+    void addStakingDelegate(const std::string &validator, uint64_t amount,
+                            const std::string &denom);
+
+    size_t size() const;
+
+    // signed tx of message index with the account number and sequence of
+    // accountinfo, the caller advances the sequence per message
+    rust::cxxbridge1::Vec<uint8_t>
+    sign(size_t index, const org::defi_wallet_core::PrivateKey &privatekey,
+         const org::defi_wallet_core::CosmosAccountInfoRaw &accountinfo) const;
+};
+
 #endif /* TxBuilder_hpp */
@@ -0,0 +1,558 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "PlayCppSdkLibrary/Include/defi-wallet-core-cpp/src/uint.rs.h"
+#include "UObject/Class.h"
+#include "CronosU256.generated.h"
+
+/**
+ * Unsigned 256-bit integer for token amounts, native so math on balances
+ * doesn't go through decimal strings or the rust U256 of the sdk
+ * limbs are the same as the sdk U256, so conversions are lossless
+ * the operators wrap around like uint64, / and % by zero give zero, use the
+ * checked* and saturating* functions where that matters
+ * the limbs are no UPROPERTY (no uint64 arrays in UE4 reflection), the
+ * struct serializes itself: raw limbs in archives (SaveGame, assets) and
+ * replication, the decimal string as text (Blueprint defaults, copy/paste)
+ */
+USTRUCT(BlueprintType)
+struct FCronosU256 {
+    GENERATED_BODY()
+
+    /// 64-bit limbs, Limbs[0] is the least significant
+    uint64 Limbs[4];
+
+    constexpr FCronosU256() : Limbs{0, 0, 0, 0} {}
+
+    constexpr FCronosU256(uint64 value) : Limbs{value, 0, 0, 0} {}
+
+    constexpr FCronosU256(uint64 limb0, uint64 limb1, uint64 limb2,
+                          uint64 limb3)
+        : Limbs{limb0, limb1, limb2, limb3} {}
+
+    explicit FCronosU256(const org::defi_wallet_core::U256 &value)
+        : Limbs{value.data[0], value.data[1], value.data[2], value.data[3]} {
+    }
+
+    org::defi_wallet_core::U256 toBridge() const {
+        org::defi_wallet_core::U256 ret;
+        ret.data = {Limbs[0], Limbs[1], Limbs[2], Limbs[3]};
+        return ret;
+    }
+
+    static constexpr FCronosU256 max() {
+        return FCronosU256(~0ULL, ~0ULL, ~0ULL, ~0ULL);
+    }
+
+    // 10^exponent, exponent up to 77
+    static constexpr FCronosU256 pow10(int32 exponent) {
+        FCronosU256 ret(1);
+        for (int32 i = 0; i < exponent; i++) {
+            ret = ret.mulSmall(10);
+        }
+        return ret;
+    }
+
+    constexpr bool isZero() const {
+        return (Limbs[0] | Limbs[1] | Limbs[2] | Limbs[3]) == 0;
+    }
+
+    // number of significant bits, 0 for zero
+    constexpr int32 bitLength() const {
+        for (int32 i = 3; i >= 0; i--) {
+            if (Limbs[i] != 0) {
+                int32 bits = 0;
+                for (uint64 limb = Limbs[i]; limb != 0; limb >>= 1) {
+                    bits++;
+                }
+                return i * 64 + bits;
+            }
+        }
+        return 0;
+    }
+
+    // -1, 0 or 1
+    static constexpr int32 compare(const FCronosU256 &a,
+                                   const FCronosU256 &b) {
+        for (int32 i = 3; i >= 0; i--) {
+            if (a.Limbs[i] != b.Limbs[i]) {
+                return a.Limbs[i] < b.Limbs[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    // a + b, returns whether it overflowed (out wraps around)
+    static constexpr bool addOverflow(const FCronosU256 &a,
+                                      const FCronosU256 &b,
+                                      FCronosU256 &out) {
+        uint64 carry = 0;
+        for (int32 i = 0; i < 4; i++) {
+            uint64 sum = a.Limbs[i] + carry;
+            carry = sum < carry ? 1 : 0;
+            out.Limbs[i] = sum + b.Limbs[i];
+            carry += out.Limbs[i] < sum ? 1 : 0;
+        }
+        return carry != 0;
+    }
+
+    // a - b, returns whether it underflowed (out wraps around)
+    static constexpr bool subOverflow(const FCronosU256 &a,
+                                      const FCronosU256 &b,
+                                      FCronosU256 &out) {
+        uint64 borrow = 0;
+        for (int32 i = 0; i < 4; i++) {
+            uint64 diff = a.Limbs[i] - b.Limbs[i];
+            uint64 next = a.Limbs[i] < b.Limbs[i] ? 1 : 0;
+            next += diff < borrow ? 1 : 0;
+            out.Limbs[i] = diff - borrow;
+            borrow = next;
+        }
+        return borrow != 0;
+    }
+
+    // a * b, returns whether it overflowed (out wraps around)
+    static constexpr bool mulOverflow(const FCronosU256 &a,
+                                      const FCronosU256 &b,
+                                      FCronosU256 &out) {
+        uint64 result[4] = {0, 0, 0, 0};
+        bool overflow = false;
+        for (int32 i = 0; i < 4; i++) {
+            uint64 carry = 0;
+            for (int32 j = 0; j < 4; j++) {
+                uint64 high = 0;
+                uint64 low = 0;
+                mul64(a.Limbs[i], b.Limbs[j], high, low);
+                if (i + j >= 4) {
+                    overflow = overflow || high != 0 || low != 0 || carry != 0;
+                    carry = 0;
+                    continue;
+                }
+                // high * 2^64 + low + carry + result fits in 128 bits
+                uint64 sum = low + carry;
+                high += sum < carry ? 1 : 0;
+                uint64 total = result[i + j] + sum;
+                high += total < sum ? 1 : 0;
+                result[i + j] = total;
+                carry = high;
+            }
+            overflow = overflow || carry != 0;
+        }
+        out = FCronosU256(result[0], result[1], result[2], result[3]);
+        return overflow;
+    }
+
+    /**
+     * a / b and a % b, returns false (and zeros) if b is zero
+     * single limb divisors up to 32 bits take the fast path
+     */
+    static constexpr bool divMod(const FCronosU256 &a, const FCronosU256 &b,
+                                 FCronosU256 &quotient,
+                                 FCronosU256 &remainder) {
+        // quotient or remainder may be a or b
+        FCronosU256 dividend = a;
+        FCronosU256 divisor = b;
+        quotient = FCronosU256();
+        remainder = FCronosU256();
+        if (divisor.isZero()) {
+            return false;
+        }
+        if ((divisor.Limbs[1] | divisor.Limbs[2] | divisor.Limbs[3]) == 0 &&
+            divisor.Limbs[0] <= 0xffffffffULL) {
+            uint32 rest = 0;
+            quotient = dividend.divSmall((uint32)divisor.Limbs[0], rest);
+            remainder = FCronosU256(rest);
+            return true;
+        }
+        // shift-subtract from the highest bit of the dividend
+        for (int32 bit = dividend.bitLength() - 1; bit >= 0; bit--) {
+            bool carry = (remainder.Limbs[3] >> 63) != 0;
+            remainder = remainder << 1;
+            remainder.Limbs[0] |= (dividend.Limbs[bit / 64] >> (bit % 64)) & 1;
+            if (carry || compare(remainder, divisor) >= 0) {
+                subOverflow(remainder, divisor, remainder);
+                quotient.Limbs[bit / 64] |= 1ULL << (bit % 64);
+            }
+        }
+        return true;
+    }
+
+    // false on overflow
+    static constexpr bool checkedAdd(const FCronosU256 &a,
+                                     const FCronosU256 &b, FCronosU256 &out) {
+        return !addOverflow(a, b, out);
+    }
+
+    // false on underflow
+    static constexpr bool checkedSub(const FCronosU256 &a,
+                                     const FCronosU256 &b, FCronosU256 &out) {
+        return !subOverflow(a, b, out);
+    }
+
+    // false on overflow
+    static constexpr bool checkedMul(const FCronosU256 &a,
+                                     const FCronosU256 &b, FCronosU256 &out) {
+        return !mulOverflow(a, b, out);
+    }
+
+    // false on division by zero
+    static constexpr bool checkedDiv(const FCronosU256 &a,
+                                     const FCronosU256 &b, FCronosU256 &out) {
+        FCronosU256 remainder;
+        return divMod(a, b, out, remainder);
+    }
+
+    static constexpr FCronosU256 saturatingAdd(const FCronosU256 &a,
+                                               const FCronosU256 &b) {
+        FCronosU256 ret;
+        return addOverflow(a, b, ret) ? max() : ret;
+    }
+
+    static constexpr FCronosU256 saturatingSub(const FCronosU256 &a,
+                                               const FCronosU256 &b) {
+        FCronosU256 ret;
+        return subOverflow(a, b, ret) ? FCronosU256() : ret;
+    }
+
+    static constexpr FCronosU256 saturatingMul(const FCronosU256 &a,
+                                               const FCronosU256 &b) {
+        FCronosU256 ret;
+        return mulOverflow(a, b, ret) ? max() : ret;
+    }
+
+    // this * factor, wrapping around
+    constexpr FCronosU256 mulSmall(uint32 factor) const {
+        FCronosU256 ret;
+        uint64 carry = 0;
+        for (int32 i = 0; i < 4; i++) {
+            uint64 low = (Limbs[i] & 0xffffffffULL) * factor + carry;
+            uint64 high = (Limbs[i] >> 32) * factor + (low >> 32);
+            ret.Limbs[i] = (high << 32) | (low & 0xffffffffULL);
+            carry = high >> 32;
+        }
+        return ret;
+    }
+
+    // this / divisor, divisor must not be zero
+    constexpr FCronosU256 divSmall(uint32 divisor, uint32 &remainder) const {
+        FCronosU256 ret;
+        uint64 rest = 0;
+        for (int32 i = 3; i >= 0; i--) {
+            uint64 high = (rest << 32) | (Limbs[i] >> 32);
+            rest = high % divisor;
+            uint64 low = (rest << 32) | (Limbs[i] & 0xffffffffULL);
+            rest = low % divisor;
+            ret.Limbs[i] = (high / divisor) << 32 | (low / divisor);
+        }
+        remainder = (uint32)rest;
+        return ret;
+    }
+
+    /**
+     * decimal or 0x hex number, false if invalid or larger than 256 bits
+     */
+    static bool parse(const FString &text, FCronosU256 &out) {
+        if (text.StartsWith(TEXT("0x"), ESearchCase::IgnoreCase)) {
+            return parseHex(text.RightChop(2), out);
+        }
+        return parseDecimal(text, out);
+    }
+
+    // digits only, no sign or separators
+    static bool parseDecimal(const FString &digits, FCronosU256 &out) {
+        if (digits.IsEmpty()) {
+            return false;
+        }
+        FCronosU256 value;
+        // 9 digits at a time fit in 32 bits
+        for (int32 start = 0; start < digits.Len(); start += 9) {
+            int32 count = FMath::Min(9, digits.Len() - start);
+            uint32 chunk = 0;
+            uint32 scale = 1;
+            for (int32 i = start; i < start + count; i++) {
+                TCHAR c = digits[i];
+                if (c < TCHAR('0') || c > TCHAR('9')) {
+                    return false;
+                }
+                chunk = chunk * 10 + (uint32)(c - TCHAR('0'));
+                scale *= 10;
+            }
+            if (mulOverflow(value, FCronosU256(scale), value) ||
+                addOverflow(value, FCronosU256(chunk), value)) {
+                return false;
+            }
+        }
+        out = value;
+        return true;
+    }
+
+    // hex digits without 0x
+    static bool parseHex(const FString &digits, FCronosU256 &out) {
+        if (digits.IsEmpty()) {
+            return false;
+        }
+        FCronosU256 value;
+        int32 significant = 0;
+        for (TCHAR c : digits) {
+            if (!FChar::IsHexDigit(c)) {
+                return false;
+            }
+            significant += significant > 0 || c != TCHAR('0') ? 1 : 0;
+            if (significant > 64) {
+                return false;
+            }
+            value = value << 4;
+            value.Limbs[0] |= (uint64)FParse::HexDigit(c);
+        }
+        out = value;
+        return true;
+    }
+
+    // decimal, e.g. "1500000000000000000"
+    FString toString() const {
+        if (isZero()) {
+            return TEXT("0");
+        }
+        // 78 digits at most
+        TCHAR buffer[80];
+        int32 start = 79;
+        buffer[start] = 0;
+        FCronosU256 rest = *this;
+        while (!rest.isZero()) {
+            uint32 chunk = 0;
+            rest = rest.divSmall(1000000000, chunk);
+            for (int32 i = 0; i < 9 && (chunk != 0 || !rest.isZero()); i++) {
+                buffer[--start] = TCHAR('0' + chunk % 10);
+                chunk /= 10;
+            }
+        }
+        return FString(&buffer[start]);
+    }
+
+    // lowercase hex with 0x, e.g. "0x14d1120d7b160000", "0x0" for zero
+    FString toHex() const {
+        FString ret = TEXT("0x");
+        bool leading = true;
+        for (int32 i = 3; i >= 0; i--) {
+            if (leading && Limbs[i] == 0 && i > 0) {
+                continue;
+            }
+            ret += leading ? FString::Printf(TEXT("%llx"),
+                                             (unsigned long long)Limbs[i])
+                           : FString::Printf(TEXT("%016llx"),
+                                             (unsigned long long)Limbs[i]);
+            leading = false;
+        }
+        return ret;
+    }
+
+    /**
+     * decimal amount in units of 10^-decimals, e.g. "1.5" with 18 decimals
+     * is 1500000000000000000
+     * false if invalid, with more fraction digits than decimals or larger
+     * than 256 bits
+     */
+    static bool parseUnits(const FString &amount, int32 decimals,
+                           FCronosU256 &out) {
+        if (decimals < 0 || decimals > 77) {
+            return false;
+        }
+        FString whole = amount;
+        FString fraction;
+        amount.Split(TEXT("."), &whole, &fraction);
+        if ((whole.IsEmpty() && fraction.IsEmpty()) ||
+            fraction.Len() > decimals) {
+            return false;
+        }
+        // ".5" and "1." are fine, "." isn't
+        return parseDecimal(whole + fraction +
+                                FString::ChrN(decimals - fraction.Len(),
+                                              TCHAR('0')),
+                            out);
+    }
+
+    /**
+     * this in units of 10^-decimals as a decimal amount, without trailing
+     * zeros, e.g. 1500000000000000000 with 18 decimals is "1.5"
+     */
+    FString formatUnits(int32 decimals) const {
+        FString digits = toString();
+        if (decimals <= 0) {
+            return digits;
+        }
+        if (digits.Len() <= decimals) {
+            digits = FString::ChrN(decimals - digits.Len() + 1, TCHAR('0')) +
+                     digits;
+        }
+        FString whole = digits.Left(digits.Len() - decimals);
+        FString fraction = digits.Right(decimals);
+        int32 length = fraction.Len();
+        while (length > 0 && fraction[length - 1] == TCHAR('0')) {
+            length--;
+        }
+        return length == 0 ? whole : whole + TEXT(".") + fraction.Left(length);
+    }
+
+    bool Serialize(FArchive &Ar) {
+        for (uint64 &limb : Limbs) {
+            Ar << limb;
+        }
+        return true;
+    }
+
+    bool NetSerialize(FArchive &Ar, class UPackageMap *Map,
+                      bool &bOutSuccess) {
+        bOutSuccess = Serialize(Ar);
+        return true;
+    }
+
+    bool ExportTextItem(FString &ValueStr, const FCronosU256 &DefaultValue,
+                        UObject *Parent, int32 PortFlags,
+                        UObject *ExportRootScope) const {
+        ValueStr += toString();
+        return true;
+    }
+
+    // a decimal or 0x hex number at Buffer, Buffer is moved past it
+    bool ImportTextItem(const TCHAR *&Buffer, int32 PortFlags, UObject *Parent,
+                        FOutputDevice *ErrorText) {
+        const TCHAR *end = Buffer;
+        while (FChar::IsAlnum(*end)) {
+            end++;
+        }
+        FCronosU256 value;
+        if (!parse(FString((int32)(end - Buffer), Buffer), value)) {
+            return false;
+        }
+        *this = value;
+        Buffer = end;
+        return true;
+    }
+
+    constexpr FCronosU256 operator<<(int32 bits) const {
+        FCronosU256 ret;
+        if (bits < 0 || bits >= 256) {
+            return ret;
+        }
+        int32 limbs = bits / 64;
+        int32 shift = bits % 64;
+        for (int32 i = 3; i >= limbs; i--) {
+            ret.Limbs[i] = Limbs[i - limbs] << shift;
+            if (shift != 0 && i - limbs > 0) {
+                ret.Limbs[i] |= Limbs[i - limbs - 1] >> (64 - shift);
+            }
+        }
+        return ret;
+    }
+
+    constexpr FCronosU256 operator>>(int32 bits) const {
+        FCronosU256 ret;
+        if (bits < 0 || bits >= 256) {
+            return ret;
+        }
+        int32 limbs = bits / 64;
+        int32 shift = bits % 64;
+        for (int32 i = 0; i + limbs < 4; i++) {
+            ret.Limbs[i] = Limbs[i + limbs] >> shift;
+            if (shift != 0 && i + limbs < 3) {
+                ret.Limbs[i] |= Limbs[i + limbs + 1] << (64 - shift);
+            }
+        }
+        return ret;
+    }
+
+  private:
+    // 64 x 64 -> 128 bit product, in 32-bit halves to stay portable
+    static constexpr void mul64(uint64 a, uint64 b, uint64 &high,
+                                uint64 &low) {
+        uint64 a0 = a & 0xffffffffULL;
+        uint64 a1 = a >> 32;
+        uint64 b0 = b & 0xffffffffULL;
+        uint64 b1 = b >> 32;
+        uint64 p00 = a0 * b0;
+        uint64 p01 = a0 * b1;
+        uint64 p10 = a1 * b0;
+        uint64 middle =
+            (p00 >> 32) + (p01 & 0xffffffffULL) + (p10 & 0xffffffffULL);
+        low = (middle << 32) | (p00 & 0xffffffffULL);
+        high = a1 * b1 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+    }
+};
+
+constexpr bool operator==(const FCronosU256 &a, const FCronosU256 &b) {
+    return FCronosU256::compare(a, b) == 0;
+}
+
+constexpr bool operator!=(const FCronosU256 &a, const FCronosU256 &b) {
+    return FCronosU256::compare(a, b) != 0;
+}
+
+constexpr bool operator<(const FCronosU256 &a, const FCronosU256 &b) {
+    return FCronosU256::compare(a, b) < 0;
+}
+
+constexpr bool operator<=(const FCronosU256 &a, const FCronosU256 &b) {
+    return FCronosU256::compare(a, b) <= 0;
+}
+
+constexpr bool operator>(const FCronosU256 &a, const FCronosU256 &b) {
+    return FCronosU256::compare(a, b) > 0;
+}
+
+constexpr bool operator>=(const FCronosU256 &a, const FCronosU256 &b) {
+    return FCronosU256::compare(a, b) >= 0;
+}
+
+constexpr FCronosU256 operator+(const FCronosU256 &a, const FCronosU256 &b) {
+    FCronosU256 ret;
+    FCronosU256::addOverflow(a, b, ret);
+    return ret;
+}
+
+constexpr FCronosU256 operator-(const FCronosU256 &a, const FCronosU256 &b) {
+    FCronosU256 ret;
+    FCronosU256::subOverflow(a, b, ret);
+    return ret;
+}
+
+constexpr FCronosU256 operator*(const FCronosU256 &a, const FCronosU256 &b) {
+    FCronosU256 ret;
+    FCronosU256::mulOverflow(a, b, ret);
+    return ret;
+}
+
+constexpr FCronosU256 operator/(const FCronosU256 &a, const FCronosU256 &b) {
+    FCronosU256 quotient;
+    FCronosU256 remainder;
+    FCronosU256::divMod(a, b, quotient, remainder);
+    return quotient;
+}
+
+constexpr FCronosU256 operator%(const FCronosU256 &a, const FCronosU256 &b) {
+    FCronosU256 quotient;
+    FCronosU256 remainder;
+    FCronosU256::divMod(a, b, quotient, remainder);
+    return remainder;
+}
+
+inline uint32 GetTypeHash(const FCronosU256 &value) {
+    uint32 hash = ::GetTypeHash(value.Limbs[0]);
+    for (int32 i = 1; i < 4; i++) {
+        hash = HashCombine(hash, ::GetTypeHash(value.Limbs[i]));
+    }
+    return hash;
+}
+
+template <>
+struct TStructOpsTypeTraits<FCronosU256>
+    : public TStructOpsTypeTraitsBase2<FCronosU256> {
+    enum {
+        WithZeroConstructor = true,
+        WithIdenticalViaEquality = true,
+        WithSerializer = true,
+        WithNetSerializer = true,
+        WithExportTextItem = true,
+        WithImportTextItem = true,
+    };
+};
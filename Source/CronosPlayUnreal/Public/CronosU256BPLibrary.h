@@ -0,0 +1,208 @@
+// Copyright 2022, Cronos Labs. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CronosU256.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "CronosU256BPLibrary.generated.h"
+
+/**
+ * Blueprint math of FCronosU256 token amounts, e.g. of the decimal strings of
+ * Erc20Balance and GetEthBalance
+ * + - * saturate, / and % by zero give zero, the Checked versions report
+ * overflow and division by zero instead
+ */
+UCLASS()
+class CRONOSPLAYUNREAL_API UCronosU256BPLibrary
+    : public UBlueprintFunctionLibrary {
+    GENERATED_BODY()
+
+  public:
+    /**
+     * Parse a decimal or 0x hex number
+     * @param Value e.g. "1500000000000000000" or "0x14d1120d7b160000"
+     * @param Success false if invalid or larger than 256 bits
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256FromString", Keywords = "U256"),
+              Category = "CronosPlayUnreal")
+    static FCronosU256 U256FromString(FString Value, bool &Success);
+
+    /**
+     * Value as U256, negative values are 0
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256FromInt64", Keywords = "U256"),
+              Category = "CronosPlayUnreal")
+    static FCronosU256 U256FromInt64(int64 Value);
+
+    /**
+     * Decimal string of Value
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256ToString", CompactNodeTitle = "->",
+                      BlueprintAutocast, Keywords = "U256"),
+              Category = "CronosPlayUnreal")
+    static FString U256ToString(FCronosU256 Value);
+
+    /**
+     * Lowercase 0x hex string of Value
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256ToHex", Keywords = "U256"),
+              Category = "CronosPlayUnreal")
+    static FString U256ToHex(FCronosU256 Value);
+
+    /**
+     * Value as int64
+     * @param Success false if Value is larger than int64, which returns the
+     * max int64
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256ToInt64", Keywords = "U256"),
+              Category = "CronosPlayUnreal")
+    static int64 U256ToInt64(FCronosU256 Value, bool &Success);
+
+    /**
+     * Decimal amount to base units, e.g. "1.5" with 18 decimals is
+     * 1500000000000000000
+     * @param Success false if invalid, with more fraction digits than
+     * Decimals or larger than 256 bits
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "ParseUnits", Keywords = "U256"),
+              Category = "CronosPlayUnreal")
+    static FCronosU256 ParseUnits(FString Amount, int32 Decimals,
+                                  bool &Success);
+
+    /**
+     * Base units to a decimal amount without trailing zeros, e.g.
+     * 1500000000000000000 with 18 decimals is "1.5"
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "FormatUnits", Keywords = "U256"),
+              Category = "CronosPlayUnreal")
+    static FString FormatUnits(FCronosU256 Value, int32 Decimals);
+
+    /**
+     * A + B, saturating at the max U256
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256 + U256", CompactNodeTitle = "+",
+                      Keywords = "U256 + add plus"),
+              Category = "CronosPlayUnreal")
+    static FCronosU256 Add_U256U256(FCronosU256 A, FCronosU256 B);
+
+    /**
+     * A - B, saturating at 0
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256 - U256", CompactNodeTitle = "-",
+                      Keywords = "U256 - subtract minus"),
+              Category = "CronosPlayUnreal")
+    static FCronosU256 Subtract_U256U256(FCronosU256 A, FCronosU256 B);
+
+    /**
+     * A * B, saturating at the max U256
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256 * U256", CompactNodeTitle = "*",
+                      Keywords = "U256 * multiply"),
+              Category = "CronosPlayUnreal")
+    static FCronosU256 Multiply_U256U256(FCronosU256 A, FCronosU256 B);
+
+    /**
+     * A / B, 0 if B is 0
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256 / U256", CompactNodeTitle = "/",
+                      Keywords = "U256 / divide division"),
+              Category = "CronosPlayUnreal")
+    static FCronosU256 Divide_U256U256(FCronosU256 A, FCronosU256 B);
+
+    /**
+     * A % B, 0 if B is 0
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256 % U256", CompactNodeTitle = "%",
+                      Keywords = "U256 % modulus"),
+              Category = "CronosPlayUnreal")
+    static FCronosU256 Percent_U256U256(FCronosU256 A, FCronosU256 B);
+
+    /**
+     * A + B
+     * @param Success false on overflow
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "CheckedAdd", Keywords = "U256"),
+              Category = "CronosPlayUnreal")
+    static FCronosU256 CheckedAdd(FCronosU256 A, FCronosU256 B,
+                                  bool &Success);
+
+    /**
+     * A - B
+     * @param Success false if B is larger than A
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "CheckedSubtract", Keywords = "U256"),
+              Category = "CronosPlayUnreal")
+    static FCronosU256 CheckedSubtract(FCronosU256 A, FCronosU256 B,
+                                       bool &Success);
+
+    /**
+     * A * B
+     * @param Success false on overflow
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "CheckedMultiply", Keywords = "U256"),
+              Category = "CronosPlayUnreal")
+    static FCronosU256 CheckedMultiply(FCronosU256 A, FCronosU256 B,
+                                       bool &Success);
+
+    /**
+     * A / B
+     * @param Success false if B is 0
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "CheckedDivide", Keywords = "U256"),
+              Category = "CronosPlayUnreal")
+    static FCronosU256 CheckedDivide(FCronosU256 A, FCronosU256 B,
+                                     bool &Success);
+
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256 == U256", CompactNodeTitle = "==",
+                      Keywords = "U256 == equal"),
+              Category = "CronosPlayUnreal")
+    static bool EqualEqual_U256U256(FCronosU256 A, FCronosU256 B);
+
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256 != U256", CompactNodeTitle = "!=",
+                      Keywords = "U256 != not equal"),
+              Category = "CronosPlayUnreal")
+    static bool NotEqual_U256U256(FCronosU256 A, FCronosU256 B);
+
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256 < U256", CompactNodeTitle = "<",
+                      Keywords = "U256 < less"),
+              Category = "CronosPlayUnreal")
+    static bool Less_U256U256(FCronosU256 A, FCronosU256 B);
+
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256 <= U256", CompactNodeTitle = "<=",
+                      Keywords = "U256 <= less"),
+              Category = "CronosPlayUnreal")
+    static bool LessEqual_U256U256(FCronosU256 A, FCronosU256 B);
+
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256 > U256", CompactNodeTitle = ">",
+                      Keywords = "U256 > greater"),
+              Category = "CronosPlayUnreal")
+    static bool Greater_U256U256(FCronosU256 A, FCronosU256 B);
+
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "U256 >= U256", CompactNodeTitle = ">=",
+                      Keywords = "U256 >= greater"),
+              Category = "CronosPlayUnreal")
+    static bool GreaterEqual_U256U256(FCronosU256 A, FCronosU256 B);
+};
@@ -17,18 +17,29 @@
 #include "DefiWalletCoreActor.generated.h"
 
 /*
-TODO:
-for erc20,erc721,erc1155
-add opaque pointer for each api, and don't recreate in very call
-add like apis
-createErc20();
-createERc721();
-createErc1155();
-destroyErc20();
-destroyErc721();
-destroyErc1155();
+erc20, erc721 and erc1155 handles are not cached: new_ercXX(...).legacy()
+only holds the address, rpc url and chain-id and connects nothing, so a cache
+would add a lock and a lookup to every call and save nothing
 */
 
+class AddressCache;
+class CosmosAccountCache;
+class CosmosSequentialTxBuilder;
+class CronosBlockClock;
+class CronosEndpointCall;
+class CronosBroadcastQueue;
+class CronosGasEstimator;
+class CronosGasOracle;
+class CronosNftIndexer;
+class CronosReceiptWatcher;
+class CronosRpcBatcher;
+class CronosTokenEnumerator;
+class GrpcClientPool;
+class NonceManager;
+class PrivateKeyCache;
+class ReadCache;
+class SingleFlight;
+
 // callback
 // eth
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FSendEthTransferDelegate,
@@ -147,6 +158,30 @@ enum class EMnemonicsWordCount : uint8 {
     TwentyFour UMETA(DisplayName = "24 mnemonics"),
 };
 
+/// coin of derived addresses
+UENUM(BlueprintType)
+enum class EWalletCoinType : uint8 {
+    CryptoOrgMainnet UMETA(DisplayName = "Crypto.org Chain mainnet"),
+    CryptoOrgTestnet UMETA(DisplayName = "Crypto.org Chain testnet"),
+    CronosMainnet UMETA(DisplayName = "Cronos mainnet beta"),
+    CosmosHub UMETA(DisplayName = "Cosmos Hub mainnet"),
+    Ethereum UMETA(DisplayName = "Ethereum, same as GetEthAddress"),
+};
+
+/**
+ * One recipient of SendAmounts
+ */
+USTRUCT(BlueprintType)
+struct FCosmosBankSend {
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString ToAddress;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    int64 Amount = 0;
+};
+
 /**
  * Cosmos NFT Owner
  */
@@ -161,6 +196,180 @@ struct FCosmosNFTOwner {
     TArray<FCosmosNFTIDCollection> IDCollections;
 };
 
+/// view function of a multicall item
+UENUM(BlueprintType)
+enum class ECronosMulticallFunction : uint8 {
+    Raw UMETA(DisplayName = "CallData as is"),
+    BalanceOf UMETA(DisplayName = "erc20, erc721 balanceOf(Account)"),
+    Erc1155BalanceOf UMETA(DisplayName = "erc1155 balanceOf(Account,TokenID)"),
+    OwnerOf UMETA(DisplayName = "erc721 ownerOf(TokenID)"),
+    TokenURI UMETA(DisplayName = "erc721 tokenURI(TokenID)"),
+    Uri UMETA(DisplayName = "erc1155 uri(TokenID)"),
+    Allowance UMETA(DisplayName = "erc20 allowance(Account,Operator)"),
+    IsApprovedForAll UMETA(DisplayName = "isApprovedForAll(Account,Operator)"),
+    Decimals UMETA(DisplayName = "erc20 decimals()"),
+    TotalSupply UMETA(DisplayName = "totalSupply()"),
+    Name UMETA(DisplayName = "name()"),
+    Symbol UMETA(DisplayName = "symbol()"),
+};
+
+/**
+ * One contract read of a multicall
+ */
+USTRUCT(BlueprintType)
+struct FCronosMulticallItem {
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString ContractAddress;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    ECronosMulticallFunction Function = ECronosMulticallFunction::BalanceOf;
+
+    /// owner or account
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString Account;
+
+    /// spender or operator
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString Operator;
+
+    /// decimal or 0x hex token id
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString TokenID;
+
+    /// 0x hex calldata, only used by Raw
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString CallData;
+};
+
+/**
+ * Result of one contract read of a multicall
+ */
+USTRUCT(BlueprintType)
+struct FCronosMulticallResult {
+    GENERATED_BODY()
+
+    /// false if the call reverted or its return data can not be decoded
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    bool Success = false;
+
+    /// 0x hex return data (revert data if failed)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString ReturnData;
+
+    /// decimal number, address, string or "true"/"false", ReturnData for Raw
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString Value;
+};
+
+/**
+ * One tx of SignEthAmounts, same fields as SignEthAmount
+ */
+USTRUCT(BlueprintType)
+struct FCronosEthTxItem {
+    GENERATED_BODY()
+
+    /// wallet index of the sender, which starts from 0
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    int32 WalletIndex = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString ToAddress;
+
+    /// amount in eth decimal, eg. 0.1 means 0.1 eth
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString Amount;
+
+    /// gas limit or "auto"
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString GasLimit;
+
+    /// gas price in wei, or "auto" / "auto:90"
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString GasPrice;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    TArray<uint8> TxData;
+};
+
+/**
+ * Signed txs of SignEthAmounts in one buffer, tx i is the bytes of Data from
+ * Offsets[i] up to Offsets[i + 1]
+ */
+USTRUCT(BlueprintType)
+struct FCronosSignedEthTxs {
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    TArray<uint8> Data;
+
+    /// start of every tx in Data, followed by Data.Num()
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    TArray<int32> Offsets;
+};
+
+// callback of async queries, Result is "" if succeed
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FWalletQueryStringDelegate, FString, Output,
+                                   FString, Result);
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FWalletQueryStringArrayDelegate,
+                                   const TArray<FString> &, Output, FString,
+                                   Result);
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FWalletQueryBoolDelegate, bool, Output,
+                                   FString, Result);
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FWalletQueryInt32Delegate, int32, Output,
+                                   FString, Result);
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FWalletQueryInt64Delegate, int64, Output,
+                                   FString, Result);
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FWalletQueryBytesDelegate,
+                                   const TArray<uint8> &, Output, FString,
+                                   Result);
+
+// cosmos nft
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FCosmosNFTOwnerDelegate, FCosmosNFTOwner,
+                                   Output, FString, Result);
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FCosmosNFTCollectionDelegate,
+                                   FCosmosNFTCollection, Output, FString,
+                                   Result);
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FCosmosNFTDenomDelegate, FCosmosNFTDenom,
+                                   Output, FString, Result);
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FCosmosNFTDenomsDelegate,
+                                   const TArray<FCosmosNFTDenom> &, Output,
+                                   FString, Result);
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FCosmosNFTTokenDelegate, FCosmosNFTToken,
+                                   Output, FString, Result);
+
+// block clock
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCronosNewBlockDelegate, int64,
+                                            BlockNumber);
+
+// multicall
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FCronosMulticallDelegate,
+                                   const TArray<FCronosMulticallResult> &,
+                                   Output, FString, Result);
+
+// erc721 enumeration
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FCronosTokenPageDelegate, int64, Handle,
+                                     int64, StartIndex,
+                                     const TArray<FString> &, TokenIDs);
+
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FCronosEnumerationDoneDelegate, int64,
+                                     Handle, int64, Total, FString, Result);
+
+// batch eth signing
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FCronosSignedEthTxsDelegate,
+                                   const FCronosSignedEthTxs &, Output,
+                                   FString, Result);
+
 UCLASS()
 class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     GENERATED_BODY()
@@ -171,9 +380,167 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
      */
     org::defi_wallet_core::Wallet *_coreWallet;
 
+    /**
+     held for reading while _coreWallet is used, possibly on a worker thread,
+     and for writing while it is set or destroyed
+     */
+    FRWLock _walletLock;
+
+    // takes ownership of wallet as _coreWallet
+    void adoptWallet(
+        rust::cxxbridge1::Box<org::defi_wallet_core::Wallet> wallet);
+
+    /**
+     address of coin at index of _coreWallet, cached, throws if there is no
+     wallet
+     */
+    FString getWalletAddress(org::defi_wallet_core::CoinType coin,
+                             int32 index);
+
+    /**
+     grpc clients for cosmos nft queries, reused across calls
+     */
+    TSharedPtr<GrpcClientPool, ESPMode::ThreadSafe> _grpcClientPool;
+
+    /**
+     identical concurrent nft queries, run once
+     */
+    TSharedPtr<SingleFlight, ESPMode::ThreadSafe> _singleFlight;
+
+    /**
+     balance and ownership answers, dropped on a new block
+     */
+    TSharedPtr<ReadCache, ESPMode::ThreadSafe> _readCache;
+
+    /**
+     local evm nonces of SendEthAmount and SignEthAmount
+     */
+    TSharedPtr<NonceManager, ESPMode::ThreadSafe> _nonceManager;
+
+    /**
+     cosmos account numbers and sequences of SendAmount and SendAmounts
+     */
+    TSharedPtr<CosmosAccountCache, ESPMode::ThreadSafe> _cosmosAccountCache;
+
+    /**
+     bank sends of sends in builder, throws on an invalid amount
+     */
+    void addBankSends(CosmosSequentialTxBuilder &builder,
+                      const TArray<FCosmosBankSend> &sends,
+                      FString amountdenom);
+
+    /**
+     derived private keys of _coreWallet, dropped by DestroyWallet or after
+     myPrivateKeyIdleTimeout
+     */
+    TSharedPtr<PrivateKeyCache, ESPMode::ThreadSafe> _privateKeyCache;
+
+    /**
+     derived addresses of _coreWallet, saved encrypted under the project
+     Saved dir by DeriveAddresses if myPersistAddressCache
+     */
+    TSharedPtr<AddressCache, ESPMode::ThreadSafe> _addressCache;
+
+    void evictIdlePrivateKeys();
+
+    /**
+     block clock of myCronosRpc while started, drives OnNewBlock and the
+     receipt polling
+     */
+    TSharedPtr<CronosBlockClock, ESPMode::ThreadSafe> _blockClock;
+    FDelegateHandle _blockClockHandle;
+
+    /**
+     nft indexer of myCronosRpc while started
+     */
+    TSharedPtr<CronosNftIndexer, ESPMode::ThreadSafe> _nftIndexer;
+
+    /**
+     running EnumerateOwnedTokens by handle, game thread only
+     */
+    TMap<int64, TSharedRef<CronosTokenEnumerator, ESPMode::ThreadSafe>>
+        _enumerations;
+    int64 _lastEnumeration;
+
+    void onNewBlock(uint64 blocknumber);
+
+    /**
+     fetch the nonce of walletIndex again on its next send
+     */
+    void resyncEthNonce(int32 walletIndex);
+
+    /**
+     read cache with myReadCacheTtl applied
+     */
+    TSharedRef<ReadCache, ESPMode::ThreadSafe> getReadCache();
+
+    /**
+     drop the cached reads of the address of walletIndex and of address,
+     after a tx of walletIndex touching address is done
+     */
+    void invalidateReads(int32 walletIndex, const FString &address);
+
+    /**
+     json-rpc batcher of myCronosRpc, with myRpcBatchSize,
+     myRpcBatchInterval and myRpcHedgeBudget applied
+     */
+    TSharedRef<CronosRpcBatcher, ESPMode::ThreadSafe> getRpcBatcher();
+
+    /**
+     broadcast queue of myCronosRpc, with myBroadcastMaxInFlight,
+     myBroadcastRateLimit and myBroadcastMaxQueued applied
+     */
+    TSharedRef<CronosBroadcastQueue, ESPMode::ThreadSafe> getBroadcastQueue();
+
+    /**
+     receipt watcher of myCronosRpc, with myReceiptPollInterval,
+     myReceiptTimeout and the broadcast queue settings applied
+     */
+    TSharedRef<CronosReceiptWatcher, ESPMode::ThreadSafe> getReceiptWatcher();
+
+    /**
+     gas limit estimator of myCronosRpc, with myGasLimitMargin applied
+     */
+    TSharedRef<CronosGasEstimator, ESPMode::ThreadSafe> getGasEstimator();
+
+    /**
+     gas price oracle of myCronosRpc, with myGasPriceTtl applied
+     */
+    TSharedRef<CronosGasOracle, ESPMode::ThreadSafe> getGasOracle();
+
+    /**
+     nft indexer of myCronosRpc, with myNftIndexChunkBlocks, the block clock
+     settings and the checkpoint file of myCronosChainID applied
+     */
+    TSharedRef<CronosNftIndexer, ESPMode::ThreadSafe> getNftIndexer();
+
+    /**
+     Multicall3 address of myCronosChainID
+     */
+    FString getMulticallAddress() const;
+
   public:
     org::defi_wallet_core::Wallet *getCoreWallet();
 
+    /**
+     private key of m/44'/cointype'/0'/0/walletIndex, derived once and cached
+     throws if there is no wallet or derivation fails
+     */
+    std::shared_ptr<
+        rust::cxxbridge1::Box<org::defi_wallet_core::PrivateKey>>
+    getPrivateKey(int32 cointype, int32 walletIndex);
+
+    /**
+     fastest healthy endpoint of myCronosRpc, myTendermintRpc or myGrpc,
+     for the sdk calls that take a single endpoint, run them through it so
+     that the pool sees their outcome
+     @param timed false for calls that wait for the chain, e.g. sends
+     waiting for their receipt
+     */
+    CronosEndpointCall callCronosRpc(bool timed = true);
+    CronosEndpointCall callTendermintRpc(bool timed = true);
+    CronosEndpointCall callGrpc(bool timed = true);
+
     /**
      * Restore wallet with mnemonics and password (Only for testing &
      * development purpose).
@@ -290,6 +657,70 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
                     int64 amount, FString amountdenom, FString &output,
                     bool &success, FString &output_message);
 
+    /**
+     * Cosmos send amounts to many recipients, e.g. server payouts.
+     * One tx per recipient (n txs and n fees, not one multi-message tx) with
+     * consecutive sequences and a single account query, stops at the first
+     * tx the node rejects, the txs before it stay sent.
+     * Blocking call, one broadcast round trip per recipient, use
+     * SendAmountsAsync or SendAmountsPipelinedAsync on the game thread
+     * @param walletIndex wallet index which starts from 0
+     * @param fromaddress sender address
+     * @param sends recipients and amounts
+     * @param amountdenom   amount denom to send
+     * @param output transaction hashes of the broadcasted txs, in order
+     * @param success whether all succeed or not
+     * @param output_message error message, "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "SendAmounts", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void SendAmounts(int32 walletIndex, FString fromaddress,
+                     const TArray<FCosmosBankSend> &sends, FString amountdenom,
+                     TArray<FString> &output, bool &success,
+                     FString &output_message);
+
+    /**
+     * Cosmos send amounts to many recipients on a worker thread, one tx per
+     * recipient like SendAmounts
+     * @param walletIndex wallet index which starts from 0
+     * @param fromaddress sender address
+     * @param sends recipients and amounts
+     * @param amountdenom   amount denom to send
+     * @param Out SendAmountsAsync callback, transaction hashes of the
+     * broadcasted txs in order, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "SendAmountsAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void SendAmountsAsync(int32 walletIndex, FString fromaddress,
+                          const TArray<FCosmosBankSend> &sends,
+                          FString amountdenom,
+                          FWalletQueryStringArrayDelegate Out);
+
+    /**
+     * Cosmos send amounts to many recipients, keeping up to
+     * myCosmosSendWindow txs in flight with consecutive sequences instead of
+     * one tx per block.
+     * A tx the node rejects is skipped and the txs behind it are signed
+     * again, inclusion is polled on myTendermintRpc every
+     * myReceiptPollInterval for up to myReceiptTimeout
+     * @param walletIndex wallet index which starts from 0
+     * @param fromaddress sender address
+     * @param sends recipients and amounts
+     * @param amountdenom   amount denom to send
+     * @param Out tx hashes by recipient, "" if not included, and the first
+     * error
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "SendAmountsPipelinedAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void SendAmountsPipelinedAsync(int32 walletIndex, FString fromaddress,
+                                   const TArray<FCosmosBankSend> &sends,
+                                   FString amountdenom,
+                                   FWalletQueryStringArrayDelegate Out);
+
     /**
      * Cosmos get address with specified index.
      * @param index  wallet index which starts from 0
@@ -305,6 +736,10 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
 
     /**
      * Cosmos get balance.
+     * Blocking call, use GetBalanceAsync on the game thread
+     * @param address cosmos address
+     * @param denom denom to query
+     * @param output balance
      * @param success whether succeed or not
      * @param output_message error message, "" if succeed
      */
@@ -314,8 +749,22 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void GetBalance(FString address, FString denom, FString &output,
                     bool &success, FString &output_message);
 
+    /**
+     * Cosmos get balance.
+     * Non-blocking version of GetBalance
+     * @param address cosmos address
+     * @param denom denom to query
+     * @param Out GetBalanceAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetBalanceAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void GetBalanceAsync(FString address, FString denom,
+                         FWalletQueryStringDelegate Out);
+
     /**
      * Cosmos get nft supply.
+     * Blocking call, use GetNFTSupplyAsync on the game thread
      * @param denomid denom id
      * @param nftowner nft owner
      * @param output nft supply
@@ -328,8 +777,22 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void GetNFTSupply(FString denomid, FString nftowner, int64 &output,
                       bool &success, FString &output_message);
 
+    /**
+     * Cosmos get nft supply.
+     * Non-blocking version of GetNFTSupply
+     * @param denomid denom id
+     * @param nftowner nft owner
+     * @param Out GetNFTSupplyAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetNFTSupplyAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void GetNFTSupplyAsync(FString denomid, FString nftowner,
+                           FWalletQueryInt64Delegate Out);
+
     /**
      * Cosmos get nft owner.
+     * Blocking call, use GetNFTOwnerAsync on the game thread
      * @param denomid denom id
      * @param nftowner nft owner
      * @param output cosmos nft owner
@@ -342,8 +805,22 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void GetNFTOwner(FString denomid, FString nftowner, FCosmosNFTOwner &output,
                      bool &success, FString &output_message);
 
+    /**
+     * Cosmos get nft owner.
+     * Non-blocking version of GetNFTOwner
+     * @param denomid denom id
+     * @param nftowner nft owner
+     * @param Out GetNFTOwnerAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetNFTOwnerAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void GetNFTOwnerAsync(FString denomid, FString nftowner,
+                          FCosmosNFTOwnerDelegate Out);
+
     /**
      * Cosmos get nft collection.
+     * Blocking call, use GetNFTCollectionAsync on the game thread
      * @param denomid denom id
      * @param output cosmos nft collection
      * @param success whether succeed or not
@@ -355,8 +832,22 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void GetNFTCollection(FString denomid, FCosmosNFTCollection &output,
                           bool &success, FString &output_message);
 
+    /**
+     * Cosmos get nft collection.
+     * Non-blocking version of GetNFTCollection
+     * @param denomid denom id
+     * @param Out GetNFTCollectionAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetNFTCollectionAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void GetNFTCollectionAsync(FString denomid,
+                               FCosmosNFTCollectionDelegate Out);
+
     /**
      * Cosmos get nft denom.
+     * Blocking call, use GetNFTDenomAsync on the game thread
      * @param denomid denom id
      * @param output cosmos nft denom
      * @param success whether succeed or not
@@ -368,8 +859,20 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void GetNFTDenom(FString denomid, FCosmosNFTDenom &output, bool &success,
                      FString &output_message);
 
+    /**
+     * Cosmos get nft denom.
+     * Non-blocking version of GetNFTDenom
+     * @param denomid denom id
+     * @param Out GetNFTDenomAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetNFTDenomAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void GetNFTDenomAsync(FString denomid, FCosmosNFTDenomDelegate Out);
+
     /**
      * Cosmos get nft denom by name
+     * Blocking call, use GetNFTDenomByNameAsync on the game thread
      * @param denomname denom name
      * @param output cosmos nft denom
      * @param success whether succeed or not
@@ -381,8 +884,21 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void GetNFTDenomByName(FString denomname, FCosmosNFTDenom &output,
                            bool &success, FString &output_message);
 
+    /**
+     * Cosmos get nft denom by name
+     * Non-blocking version of GetNFTDenomByName
+     * @param denomname denom name
+     * @param Out GetNFTDenomByNameAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetNFTDenomByNameAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void GetNFTDenomByNameAsync(FString denomname, FCosmosNFTDenomDelegate Out);
+
     /**
      * Get all nft denoms
+     * Blocking call, use GetNFTAllDenomsAsync on the game thread
      * @param output cosmos nft denom
      * @param success whether succeed or not
      * @param output_message error message, "" if succeed
@@ -393,8 +909,20 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void GetNFTAllDenoms(TArray<FCosmosNFTDenom> &output, bool &success,
                          FString &output_message);
 
+    /**
+     * Get all nft denoms
+     * Non-blocking version of GetNFTAllDenoms
+     * @param Out GetNFTAllDenomsAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetNFTAllDenomsAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void GetNFTAllDenomsAsync(FCosmosNFTDenomsDelegate Out);
+
     /**
      * Get nft token
+     * Blocking call, use GetNFTTokenAsync on the game thread
      * @param denomid denom id
      * @param tokenid token id
      * @param cosmos nft token
@@ -407,6 +935,75 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void GetNFTToken(FString denomid, FString tokenid, FCosmosNFTToken &output,
                      bool &success, FString &output_message);
 
+    /**
+     * Get nft token
+     * Non-blocking version of GetNFTToken
+     * @param denomid denom id
+     * @param tokenid token id
+     * @param Out GetNFTTokenAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetNFTTokenAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void GetNFTTokenAsync(FString denomid, FString tokenid,
+                          FCosmosNFTTokenDelegate Out);
+
+    /**
+     * Get grpc client pool statistics
+     * @param reused how many nft queries reused a pooled grpc client
+     * @param created how many grpc clients were created
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetGrpcClientPoolStats",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void GetGrpcClientPoolStats(int64 &reused, int64 &created);
+
+    /**
+     * How many queries got the result of an identical query already in
+     * flight instead of querying again: async json-rpc reads of
+     * myCronosRpc, and nft denom, token and supply queries
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetCoalescedRequestCount",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    int64 GetCoalescedRequestCount();
+
+    /**
+     * Derive the addresses of a range of wallet indexes in parallel
+     * addresses are cached, and persisted if myPersistAddressCache
+     * Blocking call, use DeriveAddressesAsync on the game thread
+     * @param coin coin of the addresses
+     * @param startIndex first wallet index
+     * @param count number of addresses
+     * @param output addresses of startIndex .. startIndex + count - 1
+     * @param success whether succeed or not
+     * @param output_message error message, "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "DeriveAddresses", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void DeriveAddresses(EWalletCoinType coin, int32 startIndex, int32 count,
+                         TArray<FString> &output, bool &success,
+                         FString &output_message);
+
+    /**
+     * Derive the addresses of a range of wallet indexes in parallel
+     * Non-blocking version of DeriveAddresses
+     * @param coin coin of the addresses
+     * @param startIndex first wallet index
+     * @param count number of addresses
+     * @param Out DeriveAddressesAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "DeriveAddressesAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void DeriveAddressesAsync(EWalletCoinType coin, int32 startIndex,
+                              int32 count,
+                              FWalletQueryStringArrayDelegate Out);
+
     /**
      * Get eth address with index
      * @param index wallet index which starts from 0
@@ -422,6 +1019,7 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
 
     /**
      * Get eth balance
+     * Blocking call, use GetEthBalanceAsync on the game thread
      * @param address eth address
      * @param output get balance
      * @param success whether succeed or not
@@ -434,8 +1032,34 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
                        FString &output_message);
 
     /**
-     * Broadcast signed eth tx
-     * @param Out  event delegate which is triggered after tx is broadcasted
+     * Get eth balance
+     * Non-blocking version of GetEthBalance
+     * @param address eth address
+     * @param Out GetEthBalanceAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetEthBalanceAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void GetEthBalanceAsync(FString address, FWalletQueryStringDelegate Out);
+
+    /**
+     * Get the cached gas price of myCronosRpc, sampled from eth_gasPrice and
+     * eth_feeHistory at most once per block (with the block clock) or
+     * myGasPriceTtl seconds
+     * @param percentile priority fee percentile, 10, 25, 50, 75 or 90
+     * @param Out GetGasPriceAsync callback, gas price in wei, Result is "" if
+     * succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetGasPriceAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void GetGasPriceAsync(int32 percentile, FWalletQueryStringDelegate Out);
+
+    /**
+     * Broadcast signed eth tx through the broadcast queue of rpc, which
+     * rate limits and retries transient errors
+     * @param Out  event delegate which is triggered as soon as the tx hash is
+     * known, use WatchEthReceiptAsync to wait for the receipt
      * @param signedtx signed tx as bytes
      * @param rpc cronos rpc server url
      */
@@ -444,18 +1068,120 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     static void BroadcastEthTxAsync(FWalletBroadcastDelegate Out,
                                     TArray<uint8> signedtx, FString rpc);
 
+    /**
+     * Wait for the receipt of a tx on myCronosRpc
+     * @param txhash tx hash as hex, with or without 0x
+     * @param Out WatchEthReceiptAsync callback, called once the receipt lands
+     * or myReceiptTimeout expires, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "WatchEthReceiptAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void WatchEthReceiptAsync(FString txhash, FSendEthTransferDelegate Out);
+
+    /**
+     * Start the block clock of myCronosRpc: OnNewBlock is triggered,
+     * pending receipts are polled once per block instead of on timers and
+     * cached balances are refreshed on every block
+     * uses newHeads of myCronosWebSocketRpc, or polls eth_blockNumber
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "StartBlockClock", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void StartBlockClock();
+
+    /**
+     * Stop the block clock
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "StopBlockClock", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void StopBlockClock();
+
+    /**
+     * Latest block number seen by the block clock, 0 if unknown
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetBlockNumber", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    int64 GetBlockNumber();
+
+    /**
+     * Txs of myCronosRpc waiting in the broadcast queue, in flight or backing
+     * off before a retry, e.g. to slow down sending when it grows
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetBroadcastQueueDepth",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    int32 GetBroadcastQueueDepth();
+
+    /**
+     * Index the erc721 ownership of contracts from their Transfer logs:
+     * backfilled from fromBlock with eth_getLogs of up to
+     * myNftIndexChunkBlocks blocks, then followed with the block clock
+     * the index is checkpointed under Saved/CronosPlayUnreal and resumed from
+     * there, contracts already indexed are not backfilled again
+     * @param contracts erc721 contract addresses
+     * @param fromBlock first block to index, e.g. the deploy block
+     * @param success whether succeed or not
+     * @param output_message error message, "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "StartNftIndexer", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void StartNftIndexer(const TArray<FString> &contracts, int64 fromBlock,
+                         bool &success, FString &output_message);
+
+    /**
+     * Stop following new blocks and save the nft index checkpoint
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "StopNftIndexer", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void StopNftIndexer();
+
+    /**
+     * Token ids of contractAddress owned by ownerAddress in the nft index,
+     * no network call
+     * @param tokenIDs owned token ids, in no particular order
+     * @param synced whether the index has caught up with the chain, false
+     * while backfilling or if the contract isn't indexed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetIndexedNftTokens",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void GetIndexedNftTokens(FString contractAddress, FString ownerAddress,
+                             TArray<FString> &tokenIDs, bool &synced);
+
+    /**
+     * Owner of tokenID of contractAddress in the nft index, "" if unknown,
+     * no network call
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetIndexedNftOwner", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    FString GetIndexedNftOwner(FString contractAddress, FString tokenID);
+
     /**
      * Sign eth amount
      * @param walletIndex wallet index which starts from 0
      * @param fromaddress sender address
      * @param toaddress receiver address
      * @param amount amount in eth decimal, eg. 0.1 means 0.1 eth
-     * @param gasLimit gas limit, fee= gasLimit * gasPrice
+     * @param gasLimit gas limit, fee= gasLimit * gasPrice, or "auto" to use
+     * the learned estimate of the contract and function plus myGasLimitMargin
      * @param gasPrice gas price in wei, eg. 1wei= 1/(10^18)eth
-     * 1wei=1/(10^9)gwei
+     * 1wei=1/(10^9)gwei, or "auto" ("auto:90" for the 90th percentile) to use
+     * the cached gas price of myCronosRpc
      * @param success whether succeed or not
      * @param output_message error message, "" if succeed
      * @return signed transaction as bytes
+     * Blocking call if gasLimit or gasPrice is "auto" and nothing is cached
+     * yet (eth_estimateGas, eth_gasPrice), which fails on the game thread,
+     * use SignEthAmountAsync there
      */
     UFUNCTION(BlueprintCallable,
               meta = (DisplayName = "SignEthAmount", Keywords = "Wallet"),
@@ -466,16 +1192,83 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
                                 TArray<uint8> txdata, bool &success,
                                 FString &output_message);
 
+    /**
+     * Sign eth amount on a worker thread, "auto" gas limits and prices may
+     * query myCronosRpc
+     * @param walletIndex wallet index which starts from 0
+     * @param fromaddress sender address
+     * @param toaddress receiver address
+     * @param amount amount in eth decimal, eg. 0.1 means 0.1 eth
+     * @param gasLimit gas limit or "auto", as in SignEthAmount
+     * @param gasPrice gas price in wei or "auto", as in SignEthAmount
+     * @param Out SignEthAmountAsync callback, signed transaction as bytes,
+     * Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "SignEthAmountAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void SignEthAmountAsync(int32 walletIndex, FString fromaddress,
+                            FString toaddress, FString amount,
+                            FString gasLimit, FString gasPrice,
+                            TArray<uint8> txdata,
+                            FWalletQueryBytesDelegate Out);
+
+    /**
+     * Sign many eth amounts at once, e.g. to pre-sign a distribution.
+     * Nonces are assigned per sender in the order of txs, the txs are signed
+     * in parallel on the task graph workers. Fails as a whole, no nonce is
+     * used then.
+     * Blocking call, use SignEthAmountsAsync on the game thread ("auto" gas
+     * limits and prices need it)
+     * @param txs txs to sign
+     * @param output signed txs in one buffer, use GetSignedEthTx for one of
+     * them
+     * @param success whether succeed or not
+     * @param output_message error message, "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "SignEthAmounts", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void SignEthAmounts(const TArray<FCronosEthTxItem> &txs,
+                        FCronosSignedEthTxs &output, bool &success,
+                        FString &output_message);
+
+    /**
+     * Sign many eth amounts on a worker thread
+     * @param txs txs to sign
+     * @param Out SignEthAmountsAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "SignEthAmountsAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void SignEthAmountsAsync(const TArray<FCronosEthTxItem> &txs,
+                             FCronosSignedEthTxsDelegate Out);
+
+    /**
+     * One signed tx of SignEthAmounts, as taken by BroadcastEthTxAsync
+     * @param txs signed txs
+     * @param index tx index which starts from 0
+     * @return signed transaction as bytes, empty if index is out of range
+     */
+    UFUNCTION(BlueprintPure,
+              meta = (DisplayName = "GetSignedEthTx", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    static TArray<uint8> GetSignedEthTx(const FCronosSignedEthTxs &txs,
+                                        int32 index);
+
     /**
      * Send eth amount
      * @param walletIndex wallet index which starts from 0
      * @param fromaddress sender address
      * @param toaddress receiver address
      * @param amountInEthDecimal amount in eth decimal, eg. 0.1 means 0.1 eth
-     * @param gasLimit gas limit, fee= gasLimit * gasPrice
+     * @param gasLimit gas limit, fee= gasLimit * gasPrice, or "auto" to use
+     * the learned estimate of the contract and function plus myGasLimitMargin
      * @param gasPriceInWei gas price in wei, eg. 1wei= 1/(10^18)eth
-     * 1wei=1/(10^9)gwei
-     * @param Out SendEthAmount callback
+     * 1wei=1/(10^9)gwei, or "auto" ("auto:90" for the 90th percentile) to use
+     * the cached gas price of myCronosRpc
+     * @param Out SendEthAmount callback, called once the receipt lands
      */
     UFUNCTION(BlueprintCallable,
               meta = (DisplayName = "SendEthAmount", Keywords = "Wallet"),
@@ -515,6 +1308,7 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
 
     /**
      * Get erc-20 balance
+     * Blocking call, use Erc20BalanceAsync on the game thread
      * @param contractAddress erc20 contract address
      * @param accountAddress account address to fetch balance
      * @param balance get balance of account address
@@ -527,8 +1321,22 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void Erc20Balance(FString contractAddress, FString accountAddress,
                       FString &balance, bool &success, FString &output_message);
 
+    /**
+     * Get erc-20 balance
+     * Non-blocking version of Erc20Balance
+     * @param contractAddress erc20 contract address
+     * @param accountAddress account address to fetch balance
+     * @param Out Erc20BalanceAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc20BalanceAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc20BalanceAsync(FString contractAddress, FString accountAddress,
+                           FWalletQueryStringDelegate Out);
+
     /**
      * Get erc-721 balance, minted token total count of this address
+     * Blocking call, use Erc721BalanceAsync on the game thread
      * @param contractAddress erc721 contract address
      * @param accountAddress account address to fetch balance
      * @param balance to get balance of this address
@@ -542,8 +1350,22 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
                        FString &balance, bool &success,
                        FString &output_message);
 
+    /**
+     * Get erc-721 balance, minted token total count of this address
+     * Non-blocking version of Erc721Balance
+     * @param contractAddress erc721 contract address
+     * @param accountAddress account address to fetch balance
+     * @param Out Erc721BalanceAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc721BalanceAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc721BalanceAsync(FString contractAddress, FString accountAddress,
+                            FWalletQueryStringDelegate Out);
+
     /**
      * Get erc-1155 balance
+     * Blocking call, use Erc1155BalanceAsync on the game thread
      * @param contractAddress erc1155 contract address
      * @param accountAddress account address to fetch balance
      * @param tokenID toiken id to fetch balance
@@ -552,14 +1374,30 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
      * @param output_message error message, "" if succeed
      */
     UFUNCTION(BlueprintCallable,
-              meta = (DisplayName = "Erc1155Balance", Keywords = "Wallet"),
+              meta = (DisplayName = "Erc1155Balance", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc1155Balance(FString contractAddress, FString accountAddress,
+                        FString tokenID, FString &balance, bool &success,
+                        FString &output_message);
+
+    /**
+     * Get erc-1155 balance
+     * Non-blocking version of Erc1155Balance
+     * @param contractAddress erc1155 contract address
+     * @param accountAddress account address to fetch balance
+     * @param tokenID toiken id to fetch balance
+     * @param Out Erc1155BalanceAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc1155BalanceAsync", Keywords = "Wallet"),
               Category = "CronosPlayUnreal")
-    void Erc1155Balance(FString contractAddress, FString accountAddress,
-                        FString tokenID, FString &balance, bool &success,
-                        FString &output_message);
+    void Erc1155BalanceAsync(FString contractAddress, FString accountAddress,
+                             FString tokenID, FWalletQueryStringDelegate Out);
 
     /**
-     * Get erc-1155 balance of batch
+     * Get erc-1155 balance of batch, in chunks of myErc1155BatchChunkSize
+     * pairs queried in parallel, a failed chunk is retried in halves
+     * Blocking call, use Erc1155BalanceOfBatchAsync on the game thread
      * @param contractAddress erc1155 contract address
      * @param accountAddresses account addresses to fetch balance
      * @param tokenIDs toiken ids to fetch balance
@@ -577,8 +1415,28 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
                                TArray<FString> &balanceofbatch, bool &success,
                                FString &output_message);
 
+    /**
+     * Get erc-1155 balance of batch, in chunks of myErc1155BatchChunkSize
+     * pairs sent at once through the json-rpc batcher, a failed chunk is
+     * retried in halves
+     * Non-blocking version of Erc1155BalanceOfBatch
+     * @param contractAddress erc1155 contract address
+     * @param accountAddresses account addresses to fetch balance
+     * @param tokenIDs toiken ids to fetch balance
+     * @param Out Erc1155BalanceOfBatchAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc1155BalanceOfBatchAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc1155BalanceOfBatchAsync(FString contractAddress,
+                                    TArray<FString> accountAddresses,
+                                    TArray<FString> tokenIDs,
+                                    FWalletQueryStringArrayDelegate Out);
+
     /**
      * Get erc-20 name
+     * Blocking call, use Erc20NameAsync on the game thread
      * @param contractAddress erc20 contract address
      * @param name get name
      * @param success whether succeed or not
@@ -590,8 +1448,21 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void Erc20Name(FString contractAddress, FString &name, bool &success,
                    FString &output_message);
 
+    /**
+     * Get erc-20 name
+     * Non-blocking version of Erc20Name
+     * @param contractAddress erc20 contract address
+     * @param Out Erc20NameAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc20NameAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc20NameAsync(FString contractAddress,
+                        FWalletQueryStringDelegate Out);
+
     /**
      * Get erc-20 symbol
+     * Blocking call, use Erc20SymbolAsync on the game thread
      * @param contractAddress erc20 contract address
      * @param symbol get symbol
      * @param success whether succeed or not
@@ -603,8 +1474,21 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void Erc20Symbol(FString contractAddress, FString &symbol, bool &success,
                      FString &output_message);
 
+    /**
+     * Get erc-20 symbol
+     * Non-blocking version of Erc20Symbol
+     * @param contractAddress erc20 contract address
+     * @param Out Erc20SymbolAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc20SymbolAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc20SymbolAsync(FString contractAddress,
+                          FWalletQueryStringDelegate Out);
+
     /**
      * Get erc-20 decimals
+     * Blocking call, use Erc20DecimalsAsync on the game thread
      * @param contractAddress erc20 contract address
      * @param decimals get decimals
      * @param success whether succeed or not
@@ -616,8 +1500,21 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void Erc20Decimals(FString contractAddress, int32 &decimals, bool &success,
                        FString &output_message);
 
+    /**
+     * Get erc-20 decimals
+     * Non-blocking version of Erc20Decimals
+     * @param contractAddress erc20 contract address
+     * @param Out Erc20DecimalsAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc20DecimalsAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc20DecimalsAsync(FString contractAddress,
+                            FWalletQueryInt32Delegate Out);
+
     /**
      * Get erc-20 total supply
+     * Blocking call, use Erc20TotalSupplyAsync on the game thread
      * @param contractAddress erc20 contract address
      * @param totalSupply get total supply
      * @param success whether succeed or not
@@ -629,8 +1526,22 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void Erc20TotalSupply(FString contractAddress, FString &totalSupply,
                           bool &success, FString &output_message);
 
+    /**
+     * Get erc-20 total supply
+     * Non-blocking version of Erc20TotalSupply
+     * @param contractAddress erc20 contract address
+     * @param Out Erc20TotalSupplyAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc20TotalSupplyAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc20TotalSupplyAsync(FString contractAddress,
+                               FWalletQueryStringDelegate Out);
+
     /**
      * Get erc-721 name
+     * Blocking call, use Erc721NameAsync on the game thread
      * @param contractAddress erc721 contract address
      * @param name get name
      * @param success whether succeed or not
@@ -642,8 +1553,21 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void Erc721Name(FString contractAddress, FString &name, bool &success,
                     FString &output_message);
 
+    /**
+     * Get erc-721 name
+     * Non-blocking version of Erc721Name
+     * @param contractAddress erc721 contract address
+     * @param Out Erc721NameAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc721NameAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc721NameAsync(FString contractAddress,
+                         FWalletQueryStringDelegate Out);
+
     /**
      * Get erc-721 symbol
+     * Blocking call, use Erc721SymbolAsync on the game thread
      * @param contractAddress contract address
      * @param symbol get symbol
      * @param success whether succeed or not
@@ -655,8 +1579,21 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void Erc721Symbol(FString contractAddress, FString &symbol, bool &success,
                       FString &output_message);
 
+    /**
+     * Get erc-721 symbol
+     * Non-blocking version of Erc721Symbol
+     * @param contractAddress contract address
+     * @param Out Erc721SymbolAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc721SymbolAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc721SymbolAsync(FString contractAddress,
+                           FWalletQueryStringDelegate Out);
+
     /**
      * Get erc-721 uri
+     * Blocking call, use Erc721UriAsync on the game thread
      * @param contractAddress erc721 contract address
      * @param tokenID token id
      * @param uri  get uri
@@ -669,8 +1606,22 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void Erc721Uri(FString contractAddress, FString tokenID, FString &uri,
                    bool &success, FString &output_message);
 
+    /**
+     * Get erc-721 uri
+     * Non-blocking version of Erc721Uri
+     * @param contractAddress erc721 contract address
+     * @param tokenID token id
+     * @param Out Erc721UriAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc721UriAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc721UriAsync(FString contractAddress, FString tokenID,
+                        FWalletQueryStringDelegate Out);
+
     /**
      * Get erc-721 Approved
+     * Blocking call, use Erc721GetApprovedAsync on the game thread
      * @param contractAddress erc721 contract address
      * @param tokenID token id
      * @param result approved
@@ -684,8 +1635,23 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
                            FString &result, bool &success,
                            FString &output_message);
 
+    /**
+     * Get erc-721 Approved
+     * Non-blocking version of Erc721GetApproved
+     * @param contractAddress erc721 contract address
+     * @param tokenID token id
+     * @param Out Erc721GetApprovedAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc721GetApprovedAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc721GetApprovedAsync(FString contractAddress, FString tokenID,
+                                FWalletQueryStringDelegate Out);
+
     /**
      * Get erc-721 IsApprovedForAll
+     * Blocking call, use Erc721IsApprovedForAllAsync on the game thread
      * @param contractAddress erc721 contract address
      * @param erc721owner owner address
      * @param erc721approvedaddress  approved address
@@ -701,8 +1667,26 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
                                 FString erc721approvedaddress, bool &result,
                                 bool &success, FString &output_message);
 
+    /**
+     * Get erc-721 IsApprovedForAll
+     * Non-blocking version of Erc721IsApprovedForAll
+     * @param contractAddress erc721 contract address
+     * @param erc721owner owner address
+     * @param erc721approvedaddress  approved address
+     * @param Out Erc721IsApprovedForAllAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc721IsApprovedForAllAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc721IsApprovedForAllAsync(FString contractAddress,
+                                     FString erc721owner,
+                                     FString erc721approvedaddress,
+                                     FWalletQueryBoolDelegate Out);
+
     /**
      * Get erc-721 owner
+     * Blocking call, use Erc721OwnerAsync on the game thread
      * @param contractAddress erc 721 contract address
      * @param tokenID token id
      * @param ercowner get owner
@@ -715,8 +1699,22 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void Erc721Owner(FString contractAddress, FString tokenID,
                      FString &ercowner, bool &success, FString &output_message);
 
+    /**
+     * Get erc-721 owner
+     * Non-blocking version of Erc721Owner
+     * @param contractAddress erc 721 contract address
+     * @param tokenID token id
+     * @param Out Erc721OwnerAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc721OwnerAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc721OwnerAsync(FString contractAddress, FString tokenID,
+                          FWalletQueryStringDelegate Out);
+
     /**
      * Get erc-721 total suppy
+     * Blocking call, use Erc721TotalSupplyAsync on the game thread
      * @param contractAddress erc 721 contract address
      * @param totalsupply total suppy
      * @param success whether succeed or not
@@ -728,9 +1726,23 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void Erc721TotalSupply(FString contractAddress, FString &totalsupply,
                            bool &success, FString &output_message);
 
+    /**
+     * Get erc-721 total suppy
+     * Non-blocking version of Erc721TotalSupply
+     * @param contractAddress erc 721 contract address
+     * @param Out Erc721TotalSupplyAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc721TotalSupplyAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc721TotalSupplyAsync(FString contractAddress,
+                                FWalletQueryStringDelegate Out);
+
     /**
      *  Returns a token ID at a given index of all the tokens stored by the
      * contract. Use along with totalSupply to enumerate all tokens.
+     * Blocking call, use Erc721TokenByIndexAsync on the game thread
      * @param contractAddress erc 721 contract address
      * @param erc721index which index
      * @param token a token ID at a given index
@@ -744,9 +1756,25 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
                             FString &token, bool &success,
                             FString &output_message);
 
+    /**
+     *  Returns a token ID at a given index of all the tokens stored by the
+     * contract. Use along with totalSupply to enumerate all tokens.
+     * Non-blocking version of Erc721TokenByIndex
+     * @param contractAddress erc 721 contract address
+     * @param erc721index which index
+     * @param Out Erc721TokenByIndexAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc721TokenByIndexAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc721TokenByIndexAsync(FString contractAddress, FString erc721index,
+                                 FWalletQueryStringDelegate Out);
+
     /**
      * Returns a token ID owned by owner at a given index of its token list. Use
      * along with balanceOf to enumerate all of owner's tokens.
+     * Blocking call, use Erc721TokenOwnerByIndexAsync on the game thread
      * @param contractAddress erc 721 contract address
      * @param erc721owner owner
      * @param erc721index which index
@@ -762,8 +1790,58 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
                                  FString erc721index, FString &token,
                                  bool &success, FString &output_message);
 
+    /**
+     * Returns a token ID owned by owner at a given index of its token list. Use
+     * along with balanceOf to enumerate all of owner's tokens.
+     * Non-blocking version of Erc721TokenOwnerByIndex
+     * @param contractAddress erc 721 contract address
+     * @param erc721owner owner
+     * @param erc721index which index
+     * @param Out Erc721TokenOwnerByIndexAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc721TokenOwnerByIndexAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc721TokenOwnerByIndexAsync(FString contractAddress,
+                                      FString erc721owner, FString erc721index,
+                                      FWalletQueryStringDelegate Out);
+
+    /**
+     * Enumerate the token IDs owned by owner of an enumerable erc721
+     * contract: balanceOf, then tokenOfOwnerByIndex of every index, in pages
+     * of myEnumerationPageSize indexes (one Multicall3 call each) with up to
+     * myEnumerationConcurrency pages in flight
+     * @param contractAddress erc 721 contract address
+     * @param ownerAddress owner
+     * @param OnPage called per page as it arrives, not necessarily in index
+     * order, with the token IDs from StartIndex on; indexes that revert
+     * because tokens were sent away meanwhile are left out
+     * @param OnDone called once after the last page, Total is the balance of
+     * owner, Result is "" if every page was delivered, an error without any
+     * page if the contract does not support ERC721Enumerable (erc165)
+     * @return handle of the enumeration for CancelEnumeration
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "EnumerateOwnedTokens",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    int64 EnumerateOwnedTokens(FString contractAddress, FString ownerAddress,
+                               FCronosTokenPageDelegate OnPage,
+                               FCronosEnumerationDoneDelegate OnDone);
+
+    /**
+     * Stop an enumeration of EnumerateOwnedTokens, neither OnPage nor OnDone
+     * is called for it afterwards
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "CancelEnumeration", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void CancelEnumeration(int64 handle);
+
     /**
      * Get erc-1155 uri
+     * Blocking call, use Erc1155UriAsync on the game thread
      * @param contractAddress erc1155 contract address
      * @param tokenID token ID
      * @param uri  get uri
@@ -776,8 +1854,22 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     void Erc1155Uri(FString contractAddress, FString tokenID, FString &uri,
                     bool &success, FString &output_message);
 
+    /**
+     * Get erc-1155 uri
+     * Non-blocking version of Erc1155Uri
+     * @param contractAddress erc1155 contract address
+     * @param tokenID token ID
+     * @param Out Erc1155UriAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc1155UriAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc1155UriAsync(FString contractAddress, FString tokenID,
+                         FWalletQueryStringDelegate Out);
+
     /**
      * Get erc-1155 IsApprovedForAll
+     * Blocking call, use Erc1155IsApprovedForAllAsync on the game thread
      * @param contractAddress erc1155 contract address
      * @param erc1155owner owner address
      * @param erc1155approvedaddress  approved address
@@ -793,6 +1885,23 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
                                  FString erc1155approvedaddress, bool &result,
                                  bool &success, FString &output_message);
 
+    /**
+     * Get erc-1155 IsApprovedForAll
+     * Non-blocking version of Erc1155IsApprovedForAll
+     * @param contractAddress erc1155 contract address
+     * @param erc1155owner owner address
+     * @param erc1155approvedaddress  approved address
+     * @param Out Erc1155IsApprovedForAllAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc1155IsApprovedForAllAsync",
+                      Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc1155IsApprovedForAllAsync(FString contractAddress,
+                                      FString erc1155owner,
+                                      FString erc1155approvedaddress,
+                                      FWalletQueryBoolDelegate Out);
+
     /**
      * erc20 Moves `amount` tokens from the caller’s account to `to_address`.
      * @param contractAddress erc20 contract
@@ -844,6 +1953,7 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
 
     /**
      * Returns the amount of tokens in existence
+     * Blocking call, use Erc20AllowanceAsync on the game thread
      * @param contractAddress erc20 contract
      * @param erc20owner erc20 owner
      * @param erc20spender erc20 spender
@@ -859,6 +1969,34 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
                         FString erc20spender, FString &result, bool &success,
                         FString &output_message);
 
+    /**
+     * Returns the amount of tokens in existence
+     * Non-blocking version of Erc20Allowance
+     * @param contractAddress erc20 contract
+     * @param erc20owner erc20 owner
+     * @param erc20spender erc20 spender
+     * @param Out Erc20AllowanceAsync callback, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "Erc20AllowanceAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void Erc20AllowanceAsync(FString contractAddress, FString erc20owner,
+                             FString erc20spender,
+                             FWalletQueryStringDelegate Out);
+
+    /**
+     * Read many erc20, erc721, erc1155 view functions in one eth_call through
+     * the Multicall3 contract of myCronosChainID
+     * @param items contract reads, a failing read does not fail the others
+     * @param Out MulticallAsync callback, results are in the order of items,
+     * Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "MulticallAsync", Keywords = "Wallet"),
+              Category = "CronosPlayUnreal")
+    void MulticallAsync(TArray<FCronosMulticallItem> items,
+                        FCronosMulticallDelegate Out);
+
     /**
      * erc721 Moves `amount` tokens from `from_address` to `to_address` using
      * the allowance mechanism.
@@ -1029,6 +2167,7 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     /**
      * Grpc address
      * for example: http://127.0.0.1:1316
+     * or a comma separated list of endpoints, the fastest healthy one is used
      */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
     FString myGrpc;
@@ -1036,6 +2175,7 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     /**
      * Cosmos rpc address
      * for example: http://127.0.0.1:1317
+     * or a comma separated list of endpoints, the fastest healthy one is used
      */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
     FString myCosmosRpc;
@@ -1043,6 +2183,7 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     /**
      * Tendermint rpc address
      * for example: http://127.0.0.1:26657
+     * or a comma separated list of endpoints, the fastest healthy one is used
      */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
     FString myTendermintRpc;
@@ -1058,6 +2199,8 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
      *  Cronos rpc address
      *  for example , devnet:  http://127.0.0.1:8545
      * testnet: https://evm-dev-t3.cronos.org
+     * or a comma separated list of endpoints, calls go to the fastest healthy
+     * one and batches are resent to another one if it isn't reached
      */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
     FString myCronosRpc;
@@ -1070,6 +2213,172 @@ class CRONOSPLAYUNREAL_API ADefiWalletCoreActor : public AActor {
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
     int32 myCronosChainID;
 
+    /**
+     * Max json-rpc calls sent in one batch to myCronosRpc by the async
+     * erc20, erc721, erc1155 queries, 1 disables batching
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    int32 myRpcBatchSize;
+
+    /**
+     * Seconds to collect json-rpc calls before sending a batch
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    float myRpcBatchInterval;
+
+    /**
+     * Extra json-rpc batches allowed as hedges, as a fraction of the read
+     * batches sent, e.g. 0.05 for 5%; 0 disables hedging
+     * with several endpoints in myCronosRpc, reads of the async queries
+     * still unanswered after the p95 latency of their endpoint are sent to
+     * another endpoint too, the first answer wins
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    float myRpcHedgeBudget;
+
+    /**
+     * Seconds between receipt polls of pending txs, all pending txs are
+     * polled in one json-rpc batch
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    float myReceiptPollInterval;
+
+    /**
+     * Seconds to wait for a receipt before the tx is reported as dropped
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    float myReceiptTimeout;
+
+    /**
+     * Max eth_sendRawTransaction calls to myCronosRpc waiting for their
+     * response
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    int32 myBroadcastMaxInFlight;
+
+    /**
+     * Txs per second broadcast to myCronosRpc, bursts up to one second worth
+     * of txs after being idle, 0 disables the limit
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    float myBroadcastRateLimit;
+
+    /**
+     * Max txs in the broadcast queue of myCronosRpc, sends fail with
+     * "Broadcast queue full" beyond it
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    int32 myBroadcastMaxQueued;
+
+    /**
+     * Cronos websocket rpc address, used by the block clock for newHeads
+     * for example: wss://evm-dev-t3.cronos.org/websocket
+     * "" polls eth_blockNumber on myCronosRpc instead
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    FString myCronosWebSocketRpc;
+
+    /**
+     * Seconds between eth_blockNumber polls of the block clock, when there is
+     * no newHeads subscription
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    float myBlockPollInterval;
+
+    /**
+     * Seconds the sampled gas price stays fresh, a new block of the block
+     * clock also refreshes it
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    float myGasPriceTtl;
+
+    /**
+     * Seconds GetEthBalance, Erc20Balance, Erc721Balance, Erc1155Balance and
+     * Erc721Owner (and their async variants) answer from cache, a new block
+     * of the block clock and our own txs touching an address refresh it
+     * sooner; 0 disables the cache
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    float myReadCacheTtl;
+
+    /**
+     * Safety margin of "auto" gas limits, 0.2 means 20% above the learned
+     * estimate of the contract and function
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    float myGasLimitMargin;
+
+    /**
+     * Seconds an unused derived private key stays in memory, 0 keeps keys
+     * until DestroyWallet
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    float myPrivateKeyIdleTimeout;
+
+    /**
+     * Save the addresses of DeriveAddresses, encrypted with a key of the
+     * wallet, under Saved/CronosPlayUnreal and load them on the next run
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    bool myPersistAddressCache;
+
+    /**
+     * Max Cosmos txs of SendAmountsPipelinedAsync broadcast but not yet in a
+     * block
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    int32 myCosmosSendWindow;
+
+    /**
+     * Broadcast the txs of SendAmountsPipelinedAsync with
+     * broadcast_tx_async, without waiting for CheckTx. A rejected tx then
+     * stops the send after myReceiptTimeout instead of being skipped
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    bool myCosmosBroadcastAsync;
+
+    /**
+     * Max blocks per eth_getLogs of the nft indexer, smaller ranges are used
+     * while the node refuses one
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    int32 myNftIndexChunkBlocks;
+
+    /**
+     * Token indexes per page of EnumerateOwnedTokens, fetched with one
+     * Multicall3 call
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    int32 myEnumerationPageSize;
+
+    /**
+     * Max pages of one EnumerateOwnedTokens in flight
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    int32 myEnumerationConcurrency;
+
+    /**
+     * Max (account, token id) pairs per balanceOfBatch call of
+     * Erc1155BalanceOfBatch, larger inputs are split so no call hits the
+     * calldata or gas cap of the node
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    int32 myErc1155BatchChunkSize;
+
+    /**
+     * Triggered once per new Cronos block while the block clock runs, e.g. to
+     * refresh balances once per block
+     */
+    UPROPERTY(BlueprintAssignable, Category = "CronosPlayUnreal")
+    FCronosNewBlockDelegate OnNewBlock;
+
+    /**
+     * Multicall3 contract address per Cronos chain-id, chains not listed use
+     * 0xcA11bde05977b3631167028862bE2a173976CA11
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CronosPlayUnreal")
+    TMap<int32, FString> myMulticallAddresses;
+
     ADefiWalletCoreActor();
 
     void CreateWallet(FString mneomnics, FString password);
@@ -268,6 +268,15 @@ class CRONOSPLAYUNREAL_API APlayCppSdkActor : public AActor {
     // Sets default values for this actor's properties
     APlayCppSdkActor();
 
+    /**
+     * Cronos evm rpc address per chain-id of the wallet-connect session
+     * a gasPrice of "auto" ("auto:90" for the 90th percentile) in the erc
+     * sends uses the cached gas price of the session chain's rpc, a chain
+     * not listed can't use "auto"
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayCppSdk")
+    TMap<int32, FString> myCronosRpcs;
+
     ::com::crypto::game_sdk::WalletconnectClient *GetClient() const {
         return _coreClient;
     };
@@ -523,7 +532,7 @@ class CRONOSPLAYUNREAL_API APlayCppSdkActor : public AActor {
      * @param toAddress to address
      * @param tokenId token id
      * @param gasLimit gas limit
-     * @param gasPrice gas price
+     * @param gasPrice gas price in wei, or "auto" (see myCronosRpcs)
      * @param Out FCronosSendContractTransactionDelegate callback
      */
     UFUNCTION(BlueprintCallable,
@@ -539,7 +548,7 @@ class CRONOSPLAYUNREAL_API APlayCppSdkActor : public AActor {
      * @param toAddress to address
      * @param tokenId token id
      * @param gasLimit gas limit
-     * @param gasPrice gas price
+     * @param gasPrice gas price in wei, or "auto" (see myCronosRpcs)
      * @param Out FCronosSendContractTransactionDelegate callback
      */
     UFUNCTION(BlueprintCallable,
@@ -557,7 +566,7 @@ class CRONOSPLAYUNREAL_API APlayCppSdkActor : public AActor {
      * @param tokenId token id
      * @param additionalData additional data
      * @param gasLimit gas limit
-     * @param gasPrice gas price
+     * @param gasPrice gas price in wei, or "auto" (see myCronosRpcs)
      * @param Out FCronosSendContractTransactionDelegate callback
      */
     UFUNCTION(BlueprintCallable,
@@ -580,7 +589,7 @@ class CRONOSPLAYUNREAL_API APlayCppSdkActor : public AActor {
      * @param approvedAddress  address to approve
      * @param tokenId token id
      * @param gasLimit gas limit
-     * @param gasPrice gas price
+     * @param gasPrice gas price in wei, or "auto" (see myCronosRpcs)
      * @param Out FCronosSendContractTransactionDelegate callback
      */
     UFUNCTION(BlueprintCallable,
@@ -597,7 +606,7 @@ class CRONOSPLAYUNREAL_API APlayCppSdkActor : public AActor {
      * @param approvedAddress address to approve
      * @param approved approved or not
      * @param gasLimit gas limit
-     * @param gasPrice gas price
+     * @param gasPrice gas price in wei, or "auto" (see myCronosRpcs)
      * @param Out FCronosSendContractTransactionDelegate callback
      */
     UFUNCTION(BlueprintCallable,
@@ -618,7 +627,7 @@ class CRONOSPLAYUNREAL_API APlayCppSdkActor : public AActor {
      * @param amount amount
      * @param additionalData additional data
      * @param gasLimit gas limit
-     * @param gasPrice gas price
+     * @param gasPrice gas price in wei, or "auto" (see myCronosRpcs)
      * @param Out FCronosSendContractTransactionDelegate callback
      */
     UFUNCTION(BlueprintCallable,
@@ -638,7 +647,7 @@ class CRONOSPLAYUNREAL_API APlayCppSdkActor : public AActor {
      * @param approvedAddress address to approve
      * @param approved approved or not
      * @param gasLimit gas limit
-     * @param gasPrice gas price
+     * @param gasPrice gas price in wei, or "auto" (see myCronosRpcs)
      * @param Out FCronosSendContractTransactionDelegate callback
      */
     UFUNCTION(BlueprintCallable,
@@ -654,7 +663,7 @@ class CRONOSPLAYUNREAL_API APlayCppSdkActor : public AActor {
      * @param toAddress to address
      * @param amount amount
      * @param gasLimit gas limit
-     * @param gasPrice gas price
+     * @param gasPrice gas price in wei, or "auto" (see myCronosRpcs)
      * @param Out FCronosSendContractTransactionDelegate callback
      */
     UFUNCTION(BlueprintCallable,
@@ -669,7 +678,7 @@ class CRONOSPLAYUNREAL_API APlayCppSdkActor : public AActor {
      * @param toAddress to address
      * @param amount amount
      * @param gasLimit gas limit
-     * @param gasPrice gas price
+     * @param gasPrice gas price in wei, or "auto" (see myCronosRpcs)
      * @param Out FCronosSendContractTransactionDelegate callback
      */
     UFUNCTION(BlueprintCallable,
@@ -687,7 +696,7 @@ class CRONOSPLAYUNREAL_API APlayCppSdkActor : public AActor {
      * @param approvedAddress address to approve
      * @param amount amount
      * @param gasLimit gas limit
-     * @param gasPrice gas price
+     * @param gasPrice gas price in wei, or "auto" (see myCronosRpcs)
      * @param Out FCronosSendContractTransactionDelegate callback
      */
     UFUNCTION(BlueprintCallable,
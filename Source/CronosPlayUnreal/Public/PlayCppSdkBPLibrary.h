@@ -78,6 +78,16 @@ struct FRawTxDetail {
     FString ContractAddress;
 };
 
+/// callback of async tx history and token transfer queries
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FRawTxDetailsDelegate,
+                                   const TArray<FRawTxDetail> &, Output,
+                                   FString, Result);
+
+/// callback of async token ownership queries
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FRawTokenResultsDelegate,
+                                   const TArray<FRawTokenResult> &, Output,
+                                   FString, Result);
+
 UCLASS()
 class UPlayCppSdkBPLibrary : public UBlueprintFunctionLibrary {
     GENERATED_UCLASS_BODY()
@@ -85,6 +95,7 @@ class UPlayCppSdkBPLibrary : public UBlueprintFunctionLibrary {
   public:
     /**
      * crono-scan api, get transaction history
+     * Blocking call, use GetTransactionHistoryAsync on the game thread
      * @param address the address to query
      * @param apikey the api key
      * @param output the output of the query
@@ -102,6 +113,7 @@ class UPlayCppSdkBPLibrary : public UBlueprintFunctionLibrary {
                                               FString &output_message);
     /**
      * crono-scan api, get erc20 transaction history
+     * Blocking call, use GetErc20TransferHistoryAsync on the game thread
      * @param address the address to query
      * @param ContractAddress the contract address to query
      * @param option the query option
@@ -127,6 +139,7 @@ class UPlayCppSdkBPLibrary : public UBlueprintFunctionLibrary {
      * (address can be empty if option is ByContract)
      * default option is by address
      * The API key can be obtained from https://cronoscan.com
+     * Blocking call, use GetErc721TransferHistoryAsync on the game thread
      * @param address the address to query
      * @param ContractAddress the contract address to query
      * @param option the query option
@@ -150,6 +163,7 @@ class UPlayCppSdkBPLibrary : public UBlueprintFunctionLibrary {
      * given the BlockScout REST API base url and the account address
      * (hexadecimal), it will return the list of all owned tokens (ref:
      * https://cronos.org/explorer/testnet3/api-docs)
+     * Blocking call, use GetTokensAsync on the game thread
      * @param blockscoutBaseUrl the base url of the BlockScout API (e.g.
      * https://cronos.org/explorer/api)
      * @param account_address the account address to query
@@ -176,6 +190,7 @@ class UPlayCppSdkBPLibrary : public UBlueprintFunctionLibrary {
     * releases, also ERC1155)
     * (ref: https://cronos.org/explorer/testnet3/api-docs)
     * NOTE: QueryOption::ByContract is not supported by BlockScout
+    * Blocking call, use GetTokenTransfersAsync on the game thread
     * @param blockscoutBaseUrl the base url of the BlockScout API (e.g.
     * https://cronos.org/explorer/api)
     * @param address the account address to query
@@ -196,6 +211,88 @@ class UPlayCppSdkBPLibrary : public UBlueprintFunctionLibrary {
                               TArray<FRawTxDetail> &output, bool &success,
                               FString &output_message);
 
+    /**
+     * Non-blocking version of GetTransactionHistoryBlocking
+     * @param address the address to query
+     * @param apikey the api key
+     * @param Out callback with the output of the query, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetTransactionHistoryAsync",
+                      Keywords = "Nft,Token,TransactionHistory,CronoScan"),
+              Category = "PlayCppSdk")
+    static void GetTransactionHistoryAsync(FString address, FString apikey,
+                                           FRawTxDetailsDelegate Out);
+
+    /**
+     * Non-blocking version of GetErc20TransferHistoryBlocking
+     * @param address the address to query
+     * @param ContractAddress the contract address to query
+     * @param option the query option
+     * @param api_key the api key
+     * @param Out callback with the output of the query, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetErc20TransferHistoryAsync",
+                      Keywords = "Nft,Token,Erc20,TransferHistory,CronoScan"),
+              Category = "PlayCppSdk")
+    static void GetErc20TransferHistoryAsync(FString address,
+                                             FString ContractAddress,
+                                             EQueryOption option,
+                                             FString api_key,
+                                             FRawTxDetailsDelegate Out);
+
+    /**
+     * Non-blocking version of GetErc721TransferHistoryBlocking
+     * @param address the address to query
+     * @param ContractAddress the contract address to query
+     * @param option the query option
+     * @param api_key the api key
+     * @param Out callback with the output of the query, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetErc721TransferHistoryAsync",
+                      Keywords = "Nft,Token,Erc721,TransferHistory,CronoScan"),
+              Category = "PlayCppSdk")
+    static void GetErc721TransferHistoryAsync(FString address,
+                                              FString ContractAddress,
+                                              EQueryOption option,
+                                              FString api_key,
+                                              FRawTxDetailsDelegate Out);
+
+    /**
+     * Non-blocking version of GetTokensBlocking
+     * @param blockscoutBaseUrl the base url of the BlockScout API (e.g.
+     * https://cronos.org/explorer/api)
+     * @param account_address the account address to query
+     * @param Out callback with the output of the query, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetTokensAsync",
+                      Keywords = "Nft,Token,Url,Blockscout"),
+              Category = "PlayCppSdk")
+    static void GetTokensAsync(FString blockscoutBaseUrl,
+                               FString account_address,
+                               FRawTokenResultsDelegate Out);
+
+    /**
+     * Non-blocking version of GetTokenTransfersBlocking
+     * @param blockscoutBaseUrl the base url of the BlockScout API (e.g.
+     * https://cronos.org/explorer/api)
+     * @param address the account address to query
+     * @param contractAddress the contract address to query
+     * @param option the query option
+     * @param Out callback with the output of the query, Result is "" if succeed
+     */
+    UFUNCTION(BlueprintCallable,
+              meta = (DisplayName = "GetTokenTransfersAsync",
+                      Keywords = "Nft,Token,Transfers,Blockscout"),
+              Category = "PlayCppSdk")
+    static void GetTokenTransfersAsync(FString blockscoutBaseUrl,
+                                       FString address, FString contractAddress,
+                                       EQueryOption option,
+                                       FRawTxDetailsDelegate Out);
+
     /**
      * Generate QRCode from string
      * @param string the string to encode